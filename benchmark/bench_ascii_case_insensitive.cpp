@@ -0,0 +1,117 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/ascii_case_insensitive.hpp"
+#include "structural/inplace_string.hpp"
+#include "structural/inplace_unordered_map.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <string_view>
+
+#include <cctype>
+#include <cstddef>
+
+namespace
+{
+constexpr std::array<std::string_view, 24> known_headers{
+    "accept",         "accept-encoding", "accept-language", "authorization", "cache-control", "connection",
+    "content-length", "content-type",    "cookie",          "date",          "etag",          "expect",
+    "forwarded",      "host",            "if-match",        "if-none-match", "origin",        "pragma",
+    "range",          "referer",         "te",              "user-agent",    "via",           "x-forwarded-for",
+};
+
+// Header names as clients send them
+constexpr std::array<std::string_view, 12> request_headers{
+    "Host",       "User-Agent",     "Accept",       "Accept-Language", "Accept-Encoding", "Cookie",
+    "Connection", "Content-Length", "X-Request-Id", "ORIGIN",          "referer",         "Cache-Control",
+};
+
+template<typename Map>
+auto make_table() -> Map
+{
+    Map table;
+    int id = 0;
+    for (auto name : known_headers)
+        table.emplace(typename Map::key_type(name.data(), name.size()), id++);
+    return table;
+}
+
+template<typename Map, typename Find>
+void run_lookup(benchmark::State& state, Find find)
+{
+    auto const table = make_table<Map>();
+    for (auto _ : state)
+    {
+        for (auto name : request_headers)
+        {
+            benchmark::DoNotOptimize(name);
+            benchmark::DoNotOptimize(find(table, name));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * request_headers.size());
+}
+
+void bm_header_lookup_lowercase_copy(benchmark::State& state)
+{
+    using map_t = structural::inplace_unordered_map<structural::inplace_string<32>, int, 32>;
+    run_lookup<map_t>(state,
+                      [](map_t const& table, std::string_view name)
+                      {
+                          structural::inplace_string<32> key;
+                          std::ranges::transform(name,
+                                                 std::back_inserter(key),
+                                                 [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+                          return table.find(key) != table.end();
+                      });
+}
+
+void bm_header_lookup_ci_string_key(benchmark::State& state)
+{
+    using map_t = structural::inplace_unordered_map<structural::inplace_ci_string<32>, int, 32>;
+    run_lookup<map_t>(state,
+                      [](map_t const& table, std::string_view name)
+                      {
+                          structural::inplace_ci_string<32> const key(name.data(), name.size());
+                          return table.find(key) != table.end();
+                      });
+}
+
+void bm_header_lookup_transparent(benchmark::State& state)
+{
+    using map_t = structural::inplace_unordered_map<structural::inplace_string<32>,
+                                                    int,
+                                                    32,
+                                                    structural::ascii_ci_hash,
+                                                    structural::ascii_ci_equal>;
+    run_lookup<map_t>(state,
+                      [](map_t const& table, std::string_view name) { return table.find(name) != table.end(); });
+}
+} // namespace
+
+BENCHMARK(bm_header_lookup_lowercase_copy);
+BENCHMARK(bm_header_lookup_ci_string_key);
+BENCHMARK(bm_header_lookup_transparent);
@@ -0,0 +1,126 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/atomic_bitset.hpp"
+#include "structural/atomic_named_bitset.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+
+#include <cstddef>
+
+STRUCTURAL_MAKE_NAMED_BITSET(feature_bits, features, logging, tracing, caching, compression, metrics, auth, retry, debug)
+
+namespace
+{
+using enum feature_bits;
+
+// Every thread toggles its own flag and reads the others, as workers publishing feature states would
+structural::atomic_named_bitset<feature_bits, features_size> atomic_flags;
+
+std::mutex flags_mutex;
+features   locked_flags;
+
+auto own_flag(benchmark::State const& state) -> feature_bits
+{
+    return static_cast<feature_bits>(state.thread_index() % features_size);
+}
+
+void bm_flags_atomic(benchmark::State& state)
+{
+    auto const flag = own_flag(state);
+    for (auto _ : state)
+    {
+        atomic_flags.set(flag);
+        benchmark::DoNotOptimize(atomic_flags.test(caching));
+        atomic_flags.reset(flag);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void bm_flags_mutex(benchmark::State& state)
+{
+    auto const flag = own_flag(state);
+    for (auto _ : state)
+    {
+        {
+            std::scoped_lock lock(flags_mutex);
+            locked_flags.set(flag);
+        }
+        {
+            std::scoped_lock lock(flags_mutex);
+            benchmark::DoNotOptimize(locked_flags.test(caching));
+        }
+        {
+            std::scoped_lock lock(flags_mutex);
+            locked_flags.reset(flag);
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Every thread repeatedly claims a free slot and releases it again
+constexpr std::size_t slot_count = 1024;
+
+structural::atomic_bitset<slot_count> atomic_slots;
+
+std::mutex                     slots_mutex;
+structural::bitset<slot_count> locked_slots;
+
+void bm_slots_atomic(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto const slot = atomic_slots.find_first_unset_and_set();
+        benchmark::DoNotOptimize(slot);
+        atomic_slots.reset(slot);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void bm_slots_mutex(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::size_t slot = 0;
+        {
+            std::scoped_lock lock(slots_mutex);
+            slot = (~locked_slots).find_first();
+            locked_slots.set(slot);
+        }
+        benchmark::DoNotOptimize(slot);
+        {
+            std::scoped_lock lock(slots_mutex);
+            locked_slots.reset(slot);
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+} // namespace
+
+BENCHMARK(bm_flags_atomic)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(bm_flags_mutex)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(bm_slots_atomic)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(bm_slots_mutex)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,367 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/bitset.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <bitset>
+#include <random>
+#include <string>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+// all() is measured on a full set and any()/none() on an empty one, so every operation has to scan the whole set
+template<typename Bitset>
+void bm_all(benchmark::State& state)
+{
+    Bitset bs;
+    bs.set();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(bs);
+        benchmark::DoNotOptimize(bs.all());
+    }
+    state.SetBytesProcessed(state.iterations() * bs.size() / 8);
+}
+
+template<typename Bitset>
+void bm_any(benchmark::State& state)
+{
+    Bitset bs;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(bs);
+        benchmark::DoNotOptimize(bs.any());
+    }
+    state.SetBytesProcessed(state.iterations() * bs.size() / 8);
+}
+
+template<typename Bitset>
+void bm_none(benchmark::State& state)
+{
+    Bitset bs;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(bs);
+        benchmark::DoNotOptimize(bs.none());
+    }
+    state.SetBytesProcessed(state.iterations() * bs.size() / 8);
+}
+
+template<typename Bitset>
+void bm_count(benchmark::State& state)
+{
+    Bitset bs;
+    for (std::size_t i = 0; i < bs.size(); i += 3)
+        bs.set(i);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(bs);
+        benchmark::DoNotOptimize(bs.count());
+    }
+    state.SetBytesProcessed(state.iterations() * bs.size() / 8);
+}
+
+template<typename Bitset>
+void bm_set(benchmark::State& state)
+{
+    Bitset bs;
+    for (auto _ : state)
+    {
+        bs.set();
+        benchmark::DoNotOptimize(bs);
+    }
+    state.SetBytesProcessed(state.iterations() * bs.size() / 8);
+}
+
+template<typename Bitset>
+void bm_reset(benchmark::State& state)
+{
+    Bitset bs;
+    for (auto _ : state)
+    {
+        bs.reset();
+        benchmark::DoNotOptimize(bs);
+    }
+    state.SetBytesProcessed(state.iterations() * bs.size() / 8);
+}
+
+template<typename Bitset>
+void bm_flip(benchmark::State& state)
+{
+    Bitset bs;
+    for (auto _ : state)
+    {
+        bs.flip();
+        benchmark::DoNotOptimize(bs);
+    }
+    state.SetBytesProcessed(state.iterations() * bs.size() / 8);
+}
+
+template<typename Bitset>
+void bm_from_ullong(benchmark::State& state)
+{
+    unsigned long long val = 0x0123'4567'89ab'cdefull;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(val);
+        Bitset bs{val};
+        benchmark::DoNotOptimize(bs);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Bitset>
+auto make_random_bitset(unsigned seed) -> Bitset
+{
+    std::mt19937 rng(seed);
+    Bitset       bs;
+    for (std::size_t i = 0; i < bs.size(); ++i)
+        bs.set(i, rng() % 2);
+    return bs;
+}
+
+template<typename Bitset, typename Op>
+void bm_binary(benchmark::State& state, Op op)
+{
+    auto       lhs = make_random_bitset<Bitset>(1);
+    auto const rhs = make_random_bitset<Bitset>(2);
+    for (auto _ : state)
+    {
+        op(lhs, rhs);
+        benchmark::DoNotOptimize(lhs);
+    }
+    state.SetBytesProcessed(state.iterations() * lhs.size() / 8);
+}
+
+template<typename Bitset>
+void bm_and(benchmark::State& state)
+{
+    bm_binary<Bitset>(state, [](Bitset& lhs, Bitset const& rhs) { lhs &= rhs; });
+}
+
+template<typename Bitset>
+void bm_or(benchmark::State& state)
+{
+    bm_binary<Bitset>(state, [](Bitset& lhs, Bitset const& rhs) { lhs |= rhs; });
+}
+
+template<typename Bitset>
+void bm_xor(benchmark::State& state)
+{
+    bm_binary<Bitset>(state, [](Bitset& lhs, Bitset const& rhs) { lhs ^= rhs; });
+}
+
+template<typename Bitset>
+void bm_not(benchmark::State& state)
+{
+    bm_binary<Bitset>(state, [](Bitset& lhs, Bitset const&) { lhs = ~lhs; });
+}
+
+// The shift distance is the benchmark argument; it is kept opaque so the shift can't be specialized on it
+template<typename Bitset>
+void bm_shift_left(benchmark::State& state)
+{
+    auto        bs       = make_random_bitset<Bitset>(1);
+    std::size_t distance = state.range(0);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(distance);
+        bs <<= distance;
+        bs.set(0);
+        benchmark::DoNotOptimize(bs);
+    }
+    state.SetBytesProcessed(state.iterations() * bs.size() / 8);
+}
+
+template<typename Bitset>
+void bm_shift_right(benchmark::State& state)
+{
+    auto        bs       = make_random_bitset<Bitset>(1);
+    std::size_t distance = state.range(0);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(distance);
+        bs >>= distance;
+        bs.set(bs.size() - 1);
+        benchmark::DoNotOptimize(bs);
+    }
+    state.SetBytesProcessed(state.iterations() * bs.size() / 8);
+}
+
+// The benchmark argument is the density of set bits in permille
+template<typename Bitset>
+auto make_bitset_with_density(std::int64_t permille) -> Bitset
+{
+    std::mt19937 rng(1);
+    Bitset       bs;
+    for (std::size_t i = 0; i < bs.size(); ++i)
+        bs.set(i, std::int64_t(rng() % 1000) < permille);
+    return bs;
+}
+
+template<typename Bitset>
+void bm_iterate_test(benchmark::State& state)
+{
+    auto const bs = make_bitset_with_density<Bitset>(state.range(0));
+    for (auto _ : state)
+    {
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i < bs.size(); ++i)
+            if (bs.test(i))
+                sum += i;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * bs.count());
+}
+
+template<typename Bitset>
+void bm_iterate_find_next(benchmark::State& state)
+{
+    auto const bs = make_bitset_with_density<Bitset>(state.range(0));
+    for (auto _ : state)
+    {
+        std::size_t sum = 0;
+        for (auto i = bs.find_first(); i != bs.npos; i = bs.find_next(i))
+            sum += i;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * bs.count());
+}
+
+template<typename Bitset>
+void bm_iterate_set_bits(benchmark::State& state)
+{
+    auto const bs = make_bitset_with_density<Bitset>(state.range(0));
+    for (auto _ : state)
+    {
+        std::size_t sum = 0;
+        for (auto i : bs.set_bits())
+            sum += i;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * bs.count());
+}
+
+template<typename Bitset>
+void bm_iterate_for_each_set(benchmark::State& state)
+{
+    auto const bs = make_bitset_with_density<Bitset>(state.range(0));
+    for (auto _ : state)
+    {
+        std::size_t sum = 0;
+        bs.for_each_set([&](std::size_t i) { sum += i; });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * bs.count());
+}
+
+template<typename Bitset>
+void bm_from_string(benchmark::State& state)
+{
+    auto const str = make_random_bitset<Bitset>(1).to_string();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(str.data());
+        Bitset bs{str};
+        benchmark::DoNotOptimize(bs);
+    }
+    state.SetBytesProcessed(state.iterations() * str.size());
+}
+
+template<typename Bitset>
+void bm_to_string(benchmark::State& state)
+{
+    auto const bs = make_random_bitset<Bitset>(1);
+    for (auto _ : state)
+    {
+        auto str = bs.to_string();
+        benchmark::DoNotOptimize(str.data());
+    }
+    state.SetBytesProcessed(state.iterations() * bs.size());
+}
+
+template<typename Bitset>
+void bm_to_inplace_string(benchmark::State& state)
+{
+    auto const bs = make_random_bitset<Bitset>(1);
+    for (auto _ : state)
+    {
+        auto str = bs.to_inplace_string();
+        benchmark::DoNotOptimize(str.data());
+    }
+    state.SetBytesProcessed(state.iterations() * bs.size());
+}
+} // namespace
+
+#define STRUCTURAL_BITSET_BENCHMARKS(name)                                                                             \
+    BENCHMARK(name<structural::bitset<64>>);                                                                           \
+    BENCHMARK(name<structural::bitset<64, std::uint8_t>>);                                                             \
+    BENCHMARK(name<std::bitset<64>>);                                                                                  \
+    BENCHMARK(name<structural::bitset<1024>>);                                                                         \
+    BENCHMARK(name<structural::bitset<1024, std::uint8_t>>);                                                           \
+    BENCHMARK(name<std::bitset<1024>>);                                                                                \
+    BENCHMARK(name<structural::bitset<65536>>);                                                                        \
+    BENCHMARK(name<structural::bitset<65536, std::uint8_t>>);                                                          \
+    BENCHMARK(name<std::bitset<65536>>);
+
+STRUCTURAL_BITSET_BENCHMARKS(bm_all)
+STRUCTURAL_BITSET_BENCHMARKS(bm_any)
+STRUCTURAL_BITSET_BENCHMARKS(bm_none)
+STRUCTURAL_BITSET_BENCHMARKS(bm_count)
+STRUCTURAL_BITSET_BENCHMARKS(bm_set)
+STRUCTURAL_BITSET_BENCHMARKS(bm_reset)
+STRUCTURAL_BITSET_BENCHMARKS(bm_flip)
+STRUCTURAL_BITSET_BENCHMARKS(bm_from_ullong)
+STRUCTURAL_BITSET_BENCHMARKS(bm_and)
+STRUCTURAL_BITSET_BENCHMARKS(bm_or)
+STRUCTURAL_BITSET_BENCHMARKS(bm_xor)
+STRUCTURAL_BITSET_BENCHMARKS(bm_not)
+
+BENCHMARK(bm_shift_left<structural::bitset<1024>>)->Arg(1)->Arg(100);
+BENCHMARK(bm_shift_left<std::bitset<1024>>)->Arg(1)->Arg(100);
+BENCHMARK(bm_shift_left<structural::bitset<65536>>)->Arg(1)->Arg(100)->Arg(5000);
+BENCHMARK(bm_shift_left<std::bitset<65536>>)->Arg(1)->Arg(100)->Arg(5000);
+BENCHMARK(bm_shift_right<structural::bitset<1024>>)->Arg(1)->Arg(100);
+BENCHMARK(bm_shift_right<std::bitset<1024>>)->Arg(1)->Arg(100);
+BENCHMARK(bm_shift_right<structural::bitset<65536>>)->Arg(1)->Arg(100)->Arg(5000);
+BENCHMARK(bm_shift_right<std::bitset<65536>>)->Arg(1)->Arg(100)->Arg(5000);
+
+BENCHMARK(bm_iterate_test<structural::bitset<65536>>)->Arg(1)->Arg(100)->Arg(900);
+BENCHMARK(bm_iterate_find_next<structural::bitset<65536>>)->Arg(1)->Arg(100)->Arg(900);
+BENCHMARK(bm_iterate_set_bits<structural::bitset<65536>>)->Arg(1)->Arg(100)->Arg(900);
+BENCHMARK(bm_iterate_for_each_set<structural::bitset<65536>>)->Arg(1)->Arg(100)->Arg(900);
+
+BENCHMARK(bm_from_string<structural::bitset<4096>>);
+BENCHMARK(bm_from_string<structural::bitset<4096, std::uint8_t>>);
+BENCHMARK(bm_from_string<std::bitset<4096>>);
+BENCHMARK(bm_to_string<structural::bitset<4096>>);
+BENCHMARK(bm_to_string<structural::bitset<4096, std::uint8_t>>);
+BENCHMARK(bm_to_string<std::bitset<4096>>);
+BENCHMARK(bm_to_inplace_string<structural::bitset<4096>>);
+BENCHMARK(bm_to_inplace_string<structural::bitset<4096, std::uint8_t>>);
@@ -0,0 +1,147 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/bitset.hpp"
+#include "structural/hierarchical_bitset.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+constexpr std::size_t id_count = std::size_t{1} << 20;
+
+using flat_bitset = structural::bitset<id_count>;
+using tree_bitset = structural::hierarchical_bitset<id_count>;
+
+// The benchmark argument is the density of set bits in units of 0.01%
+template<typename Bitset>
+auto make_bitset(std::int64_t density) -> std::unique_ptr<Bitset>
+{
+    std::mt19937 rng(1);
+    auto         bs = std::make_unique<Bitset>();
+    for (std::size_t i = 0; i < id_count; ++i)
+        if (std::int64_t(rng() % 10000) < density)
+            bs->set(i);
+    return bs;
+}
+
+template<typename Bitset>
+void bm_iterate(benchmark::State& state)
+{
+    auto const bs = make_bitset<Bitset>(state.range(0));
+    for (auto _ : state)
+    {
+        std::size_t sum = 0;
+        bs->for_each_set([&](std::size_t i) { sum += i; });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * bs->count());
+}
+
+template<typename Bitset>
+void bm_find_next(benchmark::State& state)
+{
+    auto const bs = make_bitset<Bitset>(state.range(0));
+    for (auto _ : state)
+    {
+        std::size_t sum = 0;
+        for (auto i = bs->find_first(); i != bs->npos; i = bs->find_next(i))
+            sum += i;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * bs->count());
+}
+
+template<typename Bitset>
+void bm_count(benchmark::State& state)
+{
+    auto const bs = make_bitset<Bitset>(state.range(0));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(bs->count());
+}
+
+// any() has to look at every word of an empty set
+template<typename Bitset>
+void bm_any_empty(benchmark::State& state)
+{
+    auto const bs = std::make_unique<Bitset>();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(*bs);
+        benchmark::DoNotOptimize(bs->any());
+    }
+}
+
+// Only the last ID is set, so find_first() has to skip all other words
+template<typename Bitset>
+void bm_find_first_last_only(benchmark::State& state)
+{
+    auto const bs = std::make_unique<Bitset>();
+    bs->set(id_count - 1);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(*bs);
+        benchmark::DoNotOptimize(bs->find_first());
+    }
+}
+
+template<typename Bitset>
+void bm_set_reset(benchmark::State& state)
+{
+    auto const               bs = make_bitset<Bitset>(state.range(0));
+    std::mt19937             rng(2);
+    std::vector<std::size_t> positions(1024);
+    for (auto& pos : positions)
+        pos = rng() % id_count;
+    for (auto _ : state)
+    {
+        for (auto pos : positions)
+            bs->set(pos);
+        for (auto pos : positions)
+            bs->reset(pos);
+        benchmark::DoNotOptimize(*bs);
+    }
+    state.SetItemsProcessed(state.iterations() * positions.size() * 2);
+}
+} // namespace
+
+BENCHMARK(bm_iterate<flat_bitset>)->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(bm_iterate<tree_bitset>)->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(bm_find_next<flat_bitset>)->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(bm_find_next<tree_bitset>)->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(bm_count<flat_bitset>)->Arg(1)->Arg(1000);
+BENCHMARK(bm_count<tree_bitset>)->Arg(1)->Arg(1000);
+BENCHMARK(bm_any_empty<flat_bitset>);
+BENCHMARK(bm_any_empty<tree_bitset>);
+BENCHMARK(bm_find_first_last_only<flat_bitset>);
+BENCHMARK(bm_find_first_last_only<tree_bitset>);
+BENCHMARK(bm_set_reset<flat_bitset>)->Arg(1)->Arg(1000);
+BENCHMARK(bm_set_reset<tree_bitset>)->Arg(1)->Arg(1000);
@@ -0,0 +1,180 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/inplace_bitmap_set.hpp"
+#include "structural/inplace_set.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+constexpr std::size_t universe = 4096;
+
+using bitmap_set = structural::inplace_bitmap_set<std::uint16_t, universe - 1>;
+using tree_set   = structural::inplace_set<std::uint16_t, universe>;
+
+// The benchmark argument is the number of elements in each set
+template<typename Set>
+auto make_set(std::int64_t size, unsigned seed) -> Set
+{
+    std::mt19937 rng(seed);
+    Set          s;
+    while (std::int64_t(s.size()) < size)
+        s.insert(std::uint16_t(rng() % universe));
+    return s;
+}
+
+template<typename Set>
+void bm_insert(benchmark::State& state)
+{
+    auto const values = make_set<bitmap_set>(state.range(0), 1);
+    for (auto _ : state)
+    {
+        Set s;
+        for (auto v : values)
+            s.insert(v);
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Set>
+void bm_contains(benchmark::State& state)
+{
+    auto const s = make_set<Set>(state.range(0), 1);
+    for (auto _ : state)
+    {
+        std::size_t found = 0;
+        for (std::size_t v = 0; v < universe; ++v)
+            found += s.contains(std::uint16_t(v));
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * universe);
+}
+
+template<typename Set>
+void bm_iterate(benchmark::State& state)
+{
+    auto const s = make_set<Set>(state.range(0), 1);
+    for (auto _ : state)
+    {
+        std::size_t sum = 0;
+        for (auto v : s)
+            sum += v;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void bm_union_bitmap(benchmark::State& state)
+{
+    auto const lhs = make_set<bitmap_set>(state.range(0), 1);
+    auto const rhs = make_set<bitmap_set>(state.range(0), 2);
+    for (auto _ : state)
+    {
+        auto result = lhs | rhs;
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+void bm_union_tree(benchmark::State& state)
+{
+    auto const lhs = make_set<tree_set>(state.range(0), 1);
+    auto const rhs = make_set<tree_set>(state.range(0), 2);
+    for (auto _ : state)
+    {
+        auto result = lhs;
+        result.insert(rhs.begin(), rhs.end());
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+void bm_intersection_bitmap(benchmark::State& state)
+{
+    auto const lhs = make_set<bitmap_set>(state.range(0), 1);
+    auto const rhs = make_set<bitmap_set>(state.range(0), 2);
+    for (auto _ : state)
+    {
+        auto result = lhs & rhs;
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+void bm_intersection_tree(benchmark::State& state)
+{
+    auto const lhs = make_set<tree_set>(state.range(0), 1);
+    auto const rhs = make_set<tree_set>(state.range(0), 2);
+    for (auto _ : state)
+    {
+        tree_set result;
+        for (auto v : lhs)
+            if (rhs.contains(v))
+                result.insert(v);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+void bm_difference_bitmap(benchmark::State& state)
+{
+    auto const lhs = make_set<bitmap_set>(state.range(0), 1);
+    auto const rhs = make_set<bitmap_set>(state.range(0), 2);
+    for (auto _ : state)
+    {
+        auto result = lhs - rhs;
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+void bm_difference_tree(benchmark::State& state)
+{
+    auto const lhs = make_set<tree_set>(state.range(0), 1);
+    auto const rhs = make_set<tree_set>(state.range(0), 2);
+    for (auto _ : state)
+    {
+        tree_set result;
+        for (auto v : lhs)
+            if (!rhs.contains(v))
+                result.insert(v);
+        benchmark::DoNotOptimize(result);
+    }
+}
+} // namespace
+
+BENCHMARK(bm_insert<bitmap_set>)->Arg(64)->Arg(1024);
+BENCHMARK(bm_insert<tree_set>)->Arg(64)->Arg(1024);
+BENCHMARK(bm_contains<bitmap_set>)->Arg(64)->Arg(1024);
+BENCHMARK(bm_contains<tree_set>)->Arg(64)->Arg(1024);
+BENCHMARK(bm_iterate<bitmap_set>)->Arg(64)->Arg(1024);
+BENCHMARK(bm_iterate<tree_set>)->Arg(64)->Arg(1024);
+BENCHMARK(bm_union_bitmap)->Arg(64)->Arg(1024);
+BENCHMARK(bm_union_tree)->Arg(64)->Arg(1024);
+BENCHMARK(bm_intersection_bitmap)->Arg(64)->Arg(1024);
+BENCHMARK(bm_intersection_tree)->Arg(64)->Arg(1024);
+BENCHMARK(bm_difference_bitmap)->Arg(64)->Arg(1024);
+BENCHMARK(bm_difference_tree)->Arg(64)->Arg(1024);
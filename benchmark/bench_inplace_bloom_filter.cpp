@@ -0,0 +1,151 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/inplace_bloom_filter.hpp"
+#include "structural/inplace_unordered_map.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <memory>
+#include <random>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+constexpr std::size_t query_count  = 4096;
+constexpr unsigned    hit_permille = 100;
+
+// 16 filter bits per key; the small map fits in the L2 cache, the large one does not
+template<std::size_t Keys>
+struct config
+{
+    using map_t     = structural::inplace_unordered_map<std::uint64_t, std::uint64_t, 2 * Keys>;
+    using classic_t = structural::inplace_bloom_filter<std::uint64_t, 16 * Keys, 7>;
+    using blocked_t = structural::inplace_blocked_bloom_filter<std::uint64_t, 16 * Keys, 8>;
+
+    std::array<std::uint64_t, Keys>        keys;
+    std::array<std::uint64_t, query_count> queries; // 10% of them are keys
+};
+
+using small = config<4096>;
+using large = config<262144>;
+
+template<typename Config>
+auto make_config() -> std::unique_ptr<Config>
+{
+    std::mt19937_64 rng(1);
+    auto            result = std::make_unique<Config>();
+    for (auto& key : result->keys)
+        key = rng();
+    for (auto& query : result->queries)
+        query = rng() % 1000 < hit_permille ? result->keys[rng() % result->keys.size()] : rng();
+    return result;
+}
+
+template<typename Config>
+void bm_map_find(benchmark::State& state)
+{
+    auto const data = make_config<Config>();
+    auto const map  = std::make_unique<typename Config::map_t>();
+    for (auto key : data->keys)
+        map->emplace(key, key);
+
+    for (auto _ : state)
+    {
+        std::size_t hits = 0;
+        for (auto query : data->queries)
+            hits += map->find(query) != map->end();
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * query_count);
+}
+
+template<typename Config, typename Filter>
+void bm_filtered_map_find(benchmark::State& state)
+{
+    auto const data   = make_config<Config>();
+    auto const map    = std::make_unique<typename Config::map_t>();
+    auto const filter = std::make_unique<Filter>();
+    for (auto key : data->keys)
+    {
+        map->emplace(key, key);
+        filter->insert(key);
+    }
+
+    for (auto _ : state)
+    {
+        std::size_t hits = 0;
+        for (auto query : data->queries)
+            hits += filter->might_contain(query) && map->find(query) != map->end();
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * query_count);
+}
+
+template<typename Config, typename Filter>
+void bm_might_contain(benchmark::State& state)
+{
+    auto const data   = make_config<Config>();
+    auto const filter = std::make_unique<Filter>();
+    for (auto key : data->keys)
+        filter->insert(key);
+
+    for (auto _ : state)
+    {
+        std::size_t positives = 0;
+        for (auto query : data->queries)
+            positives += filter->might_contain(query);
+        benchmark::DoNotOptimize(positives);
+    }
+    state.SetItemsProcessed(state.iterations() * query_count);
+}
+
+template<typename Config, typename Filter>
+void bm_insert(benchmark::State& state)
+{
+    auto const data   = make_config<Config>();
+    auto const filter = std::make_unique<Filter>();
+    for (auto _ : state)
+    {
+        for (auto key : data->keys)
+            filter->insert(key);
+        benchmark::DoNotOptimize(filter.get());
+    }
+    state.SetItemsProcessed(state.iterations() * data->keys.size());
+}
+} // namespace
+
+BENCHMARK(bm_map_find<small>);
+BENCHMARK(bm_filtered_map_find<small, small::classic_t>);
+BENCHMARK(bm_filtered_map_find<small, small::blocked_t>);
+BENCHMARK(bm_map_find<large>);
+BENCHMARK(bm_filtered_map_find<large, large::classic_t>);
+BENCHMARK(bm_filtered_map_find<large, large::blocked_t>);
+BENCHMARK(bm_might_contain<large, large::classic_t>);
+BENCHMARK(bm_might_contain<large, large::blocked_t>);
+BENCHMARK(bm_insert<large, large::classic_t>);
+BENCHMARK(bm_insert<large, large::blocked_t>);
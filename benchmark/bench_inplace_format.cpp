@@ -0,0 +1,185 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/inplace_format.hpp"
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <charconv>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+// Values as a metrics exporter would see them: counters of all magnitudes and gauges with a few decimals
+constexpr std::size_t sample_count = 1024;
+
+auto make_counters() -> std::vector<std::int64_t>
+{
+    std::mt19937_64               rng{3};
+    std::uniform_int_distribution digits{1, 18};
+    std::vector<std::int64_t>     result(sample_count);
+    for (auto& v : result)
+    {
+        std::int64_t limit = 1;
+        for (int i = digits(rng); i > 0; --i)
+            limit *= 10;
+        v = static_cast<std::int64_t>(rng() % static_cast<std::uint64_t>(limit));
+    }
+    return result;
+}
+
+auto make_gauges() -> std::vector<double>
+{
+    std::mt19937_64               rng{5};
+    std::uniform_int_distribution milli{0, 10'000'000};
+    std::vector<double>           result(sample_count);
+    for (auto& v : result)
+        v = milli(rng) / 1000.0;
+    return result;
+}
+
+template<typename Append, typename T>
+void run_append(benchmark::State& state, std::vector<T> const& values, Append append)
+{
+    for (auto _ : state)
+    {
+        for (auto v : values)
+        {
+            structural::inplace_string<32> str = "value=";
+            append(str, v);
+            benchmark::DoNotOptimize(str);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+void bm_int_append_int(benchmark::State& state)
+{
+    run_append(state, make_counters(), [](auto& str, std::int64_t v) { structural::append_int(str, v); });
+}
+
+void bm_int_to_chars_copy(benchmark::State& state)
+{
+    run_append(state,
+               make_counters(),
+               [](auto& str, std::int64_t v)
+               {
+                   char       buffer[32];
+                   auto const last = std::to_chars(buffer, buffer + 32, v).ptr;
+                   str.append(buffer, static_cast<std::size_t>(last - buffer));
+               });
+}
+
+void bm_int_fmt_format_to(benchmark::State& state)
+{
+    run_append(state,
+               make_counters(),
+               [](auto& str, std::int64_t v)
+               {
+                   char       buffer[32];
+                   auto const last = fmt::format_to(buffer, "{}", v);
+                   str.append(buffer, static_cast<std::size_t>(last - buffer));
+               });
+}
+
+void bm_float_append_float(benchmark::State& state)
+{
+    run_append(state, make_gauges(), [](auto& str, double v) { structural::append_float(str, v); });
+}
+
+void bm_float_to_chars_copy(benchmark::State& state)
+{
+    run_append(state,
+               make_gauges(),
+               [](auto& str, double v)
+               {
+                   char       buffer[32];
+                   auto const last = std::to_chars(buffer, buffer + 32, v).ptr;
+                   str.append(buffer, static_cast<std::size_t>(last - buffer));
+               });
+}
+
+void bm_float_fmt_format_to(benchmark::State& state)
+{
+    run_append(state,
+               make_gauges(),
+               [](auto& str, double v)
+               {
+                   char       buffer[32];
+                   auto const last = fmt::format_to(buffer, "{}", v);
+                   str.append(buffer, static_cast<std::size_t>(last - buffer));
+               });
+}
+
+// One exposition line per sample: name, label, counter and gauge
+template<typename Format>
+void run_format_line(benchmark::State& state, Format format)
+{
+    auto const counters = make_counters();
+    auto const gauges   = make_gauges();
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < sample_count; ++i)
+            benchmark::DoNotOptimize(format(counters[i], gauges[i]));
+    }
+    state.SetItemsProcessed(state.iterations() * sample_count);
+}
+
+void bm_line_inplace_format(benchmark::State& state)
+{
+    run_format_line(state,
+                    [](std::int64_t c, double g)
+                    {
+                        return structural::inplace_format<96>(
+                            "{}{{host=\"{}\"}} {} {}\n", "http_requests_total", "web-01", c, g);
+                    });
+}
+
+void bm_line_fmt_format_to(benchmark::State& state)
+{
+    run_format_line(state,
+                    [](std::int64_t c, double g)
+                    {
+                        char       buffer[96];
+                        auto const last = fmt::format_to(
+                            buffer, "{}{{host=\"{}\"}} {} {}\n", "http_requests_total", "web-01", c, g);
+                        return structural::inplace_string<96>(buffer, static_cast<std::size_t>(last - buffer));
+                    });
+}
+} // namespace
+
+BENCHMARK(bm_int_append_int);
+BENCHMARK(bm_int_to_chars_copy);
+BENCHMARK(bm_int_fmt_format_to);
+BENCHMARK(bm_float_append_float);
+BENCHMARK(bm_float_to_chars_copy);
+BENCHMARK(bm_float_fmt_format_to);
+BENCHMARK(bm_line_inplace_format);
+BENCHMARK(bm_line_fmt_format_to);
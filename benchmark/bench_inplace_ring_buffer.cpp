@@ -0,0 +1,70 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/inplace_ring_buffer.hpp"
+#include "structural/inplace_vector.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+namespace
+{
+template<typename Queue, typename PopFront>
+void run_fifo(benchmark::State& state, PopFront pop_front)
+{
+    Queue      queue;
+    auto const fill = static_cast<int>(state.range(0));
+    for (int i = 0; i < fill; ++i)
+        queue.push_back(i);
+
+    int next = fill;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(queue.front());
+        pop_front(queue);
+        queue.push_back(next++);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<std::size_t Capacity>
+void bm_fifo_inplace_ring_buffer(benchmark::State& state)
+{
+    run_fifo<structural::inplace_ring_buffer<int, Capacity>>(state, [](auto& q) { q.pop_front(); });
+}
+
+template<std::size_t Capacity>
+void bm_fifo_inplace_vector(benchmark::State& state)
+{
+    run_fifo<structural::inplace_vector<int, Capacity>>(state, [](auto& q) { q.erase(q.begin()); });
+}
+} // namespace
+
+BENCHMARK(bm_fifo_inplace_ring_buffer<64>)->Arg(8)->Arg(63);
+BENCHMARK(bm_fifo_inplace_vector<64>)->Arg(8)->Arg(63);
+BENCHMARK(bm_fifo_inplace_ring_buffer<100>)->Arg(8)->Arg(99);
+BENCHMARK(bm_fifo_inplace_vector<100>)->Arg(8)->Arg(99);
+BENCHMARK(bm_fifo_inplace_ring_buffer<1024>)->Arg(1023);
+BENCHMARK(bm_fifo_inplace_vector<1024>)->Arg(1023);
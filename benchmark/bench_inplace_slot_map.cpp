@@ -0,0 +1,153 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/inplace_slot_map.hpp"
+#include "structural/inplace_unordered_map.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <concepts>
+#include <memory>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+struct entity
+{
+    float x  = 0;
+    float y  = 0;
+    float z  = 0;
+    int   hp = 100;
+};
+
+constexpr std::size_t entity_count = 512;
+
+// The map gets twice the capacity, as recommended for inplace_unordered_map.
+using slot_map_t = structural::inplace_slot_map<entity, entity_count>;
+using hash_map_t = structural::inplace_unordered_map<std::uint32_t, entity, 2 * entity_count>;
+
+void bm_insert_slot_map(benchmark::State& state)
+{
+    auto sm = std::make_unique<slot_map_t>();
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < entity_count; ++i)
+            benchmark::DoNotOptimize(sm->insert(entity{}));
+        state.PauseTiming();
+        sm->clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * entity_count);
+}
+
+void bm_insert_unordered_map(benchmark::State& state)
+{
+    auto          map     = std::make_unique<hash_map_t>();
+    std::uint32_t next_id = 0;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < entity_count; ++i)
+            benchmark::DoNotOptimize(map->emplace(next_id++, entity{}));
+        state.PauseTiming();
+        map->clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * entity_count);
+}
+
+void bm_erase_slot_map(benchmark::State& state)
+{
+    auto                                              sm = std::make_unique<slot_map_t>();
+    std::array<structural::slot_handle, entity_count> handles;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        for (auto& h : handles)
+            h = sm->insert(entity{});
+        state.ResumeTiming();
+        for (auto const& h : handles)
+            benchmark::DoNotOptimize(sm->erase(h));
+    }
+    state.SetItemsProcessed(state.iterations() * entity_count);
+}
+
+void bm_erase_unordered_map(benchmark::State& state)
+{
+    auto          map     = std::make_unique<hash_map_t>();
+    std::uint32_t next_id = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto const first_id = next_id;
+        for (std::size_t i = 0; i < entity_count; ++i)
+            map->emplace(next_id++, entity{});
+        state.ResumeTiming();
+        for (std::uint32_t id = first_id; id != next_id; ++id)
+            benchmark::DoNotOptimize(map->erase(id));
+    }
+    state.SetItemsProcessed(state.iterations() * entity_count);
+}
+
+template<typename Container, typename Insert>
+void run_iterate(benchmark::State& state, Insert insert)
+{
+    auto c = std::make_unique<Container>();
+    for (std::size_t i = 0; i < entity_count; ++i)
+        insert(*c, i);
+    for (auto _ : state)
+    {
+        int total = 0;
+        for (auto const& e : *c)
+        {
+            if constexpr (std::same_as<Container, slot_map_t>)
+                total += e.hp;
+            else
+                total += e.second.hp;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * entity_count);
+}
+
+void bm_iterate_slot_map(benchmark::State& state)
+{
+    run_iterate<slot_map_t>(state, [](auto& sm, std::size_t) { sm.insert(entity{}); });
+}
+
+void bm_iterate_unordered_map(benchmark::State& state)
+{
+    run_iterate<hash_map_t>(state,
+                            [](auto& map, std::size_t i) { map.emplace(static_cast<std::uint32_t>(i), entity{}); });
+}
+} // namespace
+
+BENCHMARK(bm_insert_slot_map);
+BENCHMARK(bm_insert_unordered_map);
+BENCHMARK(bm_erase_slot_map);
+BENCHMARK(bm_erase_unordered_map);
+BENCHMARK(bm_iterate_slot_map);
+BENCHMARK(bm_iterate_unordered_map);
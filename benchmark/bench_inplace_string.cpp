@@ -0,0 +1,218 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/detail/inplace_string_storage.hpp"
+#include "structural/inplace_string.hpp"
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <array>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <cstddef>
+
+namespace
+{
+// Fragments of a typical log line, appended one by one
+constexpr std::array<std::string_view, 20> fragments{
+    "2026-10-18T12:00:00Z", " ", "[info]", " ", "worker", "#", "3", ": ", "request", " ", "GET", " ",
+    "/api/v1/items",        " ", "took",   " ", "12",     "ms", ",", " status=200",
+};
+
+void bm_build_inplace_string(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        structural::inplace_string<128> line;
+        for (auto f : fragments)
+            line += f;
+        line += '\n';
+        benchmark::DoNotOptimize(line);
+    }
+    state.SetItemsProcessed(state.iterations() * fragments.size());
+}
+
+void bm_build_std_string(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::string line;
+        for (auto f : fragments)
+            line += f;
+        line += '\n';
+        benchmark::DoNotOptimize(line);
+    }
+    state.SetItemsProcessed(state.iterations() * fragments.size());
+}
+
+void bm_build_fmt_memory_buffer(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        fmt::memory_buffer line;
+        for (auto f : fragments)
+            line.append(f);
+        line.push_back('\n');
+        benchmark::DoNotOptimize(line);
+    }
+    state.SetItemsProcessed(state.iterations() * fragments.size());
+}
+
+constexpr std::string_view http_request = "GET /api/v1/items?page=2&sort=name HTTP/1.1\r\n"
+                                          "Host: service.internal.example.org\r\n"
+                                          "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Gecko/20100101 Firefox/125.0\r\n"
+                                          "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8\r\n"
+                                          "Accept-Language: en-US,en;q=0.5\r\n"
+                                          "Accept-Encoding: gzip, deflate, br\r\n"
+                                          "Cookie: session=0123456789abcdef0123456789abcdef; theme=dark\r\n"
+                                          "Connection: keep-alive\r\n"
+                                          "Content-Length: 0\r\n"
+                                          "\r\n";
+
+// Splits the request into header lines and each line into name and value, as a parser would.
+template<typename String>
+auto scan_headers(String const& request) -> std::size_t
+{
+    std::size_t checksum = request.find("\r\n\r\n");
+    std::size_t line     = request.find('\n') + 1;
+    while (line < request.size())
+    {
+        auto const colon = request.find_first_of(":\r", line);
+        auto const eol   = request.find('\n', colon);
+        checksum += colon - line;
+        line = eol + 1;
+    }
+    checksum += request.find("Content-Length");
+    return checksum;
+}
+
+void bm_scan_headers_inplace_string(benchmark::State& state)
+{
+    structural::inplace_string<1024> const request(http_request);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(scan_headers(request));
+    state.SetBytesProcessed(state.iterations() * http_request.size());
+}
+
+void bm_scan_headers_string_view(benchmark::State& state)
+{
+    std::string_view const request = http_request;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(request);
+        benchmark::DoNotOptimize(scan_headers(request));
+    }
+    state.SetBytesProcessed(state.iterations() * http_request.size());
+}
+
+// Symbol-table column: count the rows equal to a given symbol. The compact layout (size packed into the last
+// character) is compared against the same characters with a separate size member and against std::string.
+struct sized_symbol
+{
+    structural::detail::inplace_string_storage<char, 15, false> storage;
+
+    [[nodiscard]] auto view() const noexcept -> std::string_view { return {storage.chars.data(), storage.size()}; }
+};
+
+constexpr std::size_t symbol_rows = 1 << 20;
+
+auto make_symbols() -> std::vector<std::string>
+{
+    std::mt19937                  rng{7};
+    std::uniform_int_distribution length{1, 15};
+    std::uniform_int_distribution letter{'a', 'd'};
+    std::vector<std::string>      result(symbol_rows);
+    for (auto& sym : result)
+    {
+        sym.resize(length(rng));
+        for (auto& c : sym)
+            c = static_cast<char>(letter(rng));
+    }
+    return result;
+}
+
+template<typename Symbol, typename Make, typename View>
+void run_symbol_compare(benchmark::State& state, Make make, View view)
+{
+    auto const          source = make_symbols();
+    std::vector<Symbol> column;
+    column.reserve(symbol_rows);
+    for (auto const& sym : source)
+        column.push_back(make(sym));
+    std::string_view const needle = source[symbol_rows / 2];
+
+    for (auto _ : state)
+    {
+        std::size_t hits = 0;
+        for (auto const& sym : column)
+            hits += view(sym) == needle;
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * symbol_rows);
+    state.counters["bytes_per_symbol"] = sizeof(Symbol);
+}
+
+void bm_symbol_compare_inplace_string(benchmark::State& state)
+{
+    run_symbol_compare<structural::inplace_string<15>>(
+        state,
+        [](std::string const& s) { return structural::inplace_string<15>(std::string_view(s)); },
+        [](structural::inplace_string<15> const& s) { return std::string_view(s); });
+}
+
+void bm_symbol_compare_sized(benchmark::State& state)
+{
+    run_symbol_compare<sized_symbol>(
+        state,
+        [](std::string const& s)
+        {
+            sized_symbol sym{};
+            s.copy(sym.storage.chars.data(), s.size());
+            sym.storage.set_size(s.size());
+            return sym;
+        },
+        [](sized_symbol const& s) { return s.view(); });
+}
+
+void bm_symbol_compare_std_string(benchmark::State& state)
+{
+    run_symbol_compare<std::string>(
+        state,
+        [](std::string const& s) { return s; },
+        [](std::string const& s) { return std::string_view(s); });
+}
+} // namespace
+
+BENCHMARK(bm_build_inplace_string);
+BENCHMARK(bm_build_std_string);
+BENCHMARK(bm_build_fmt_memory_buffer);
+BENCHMARK(bm_scan_headers_inplace_string);
+BENCHMARK(bm_scan_headers_string_view);
+BENCHMARK(bm_symbol_compare_inplace_string);
+BENCHMARK(bm_symbol_compare_sized);
+BENCHMARK(bm_symbol_compare_std_string);
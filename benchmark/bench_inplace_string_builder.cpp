@@ -0,0 +1,147 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/inplace_string.hpp"
+#include "structural/inplace_string_builder.hpp"
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <array>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+namespace
+{
+struct log_record
+{
+    std::string_view user;
+    std::string_view address;
+    int              request;
+    double           millis;
+};
+
+constexpr std::array<log_record, 4> records{{
+    {"alice", "10.0.0.17", 1042, 12.5},
+    {"bob", "192.168.178.4", 7, 0.25},
+    {"carol", "172.16.5.200", 918273, 1534.75},
+    {"dave", "10.10.10.10", 31, 3.0},
+}};
+
+void bm_ostringstream(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        for (auto const& r : records)
+        {
+            std::ostringstream os;
+            os << "user " << r.user << " from " << r.address << ": request " << r.request << " took " << r.millis
+               << "ms";
+            benchmark::DoNotOptimize(os.str());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+}
+
+void bm_inplace_string_builder(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        for (auto const& r : records)
+        {
+            structural::inplace_string_builder<128> os;
+            os << "user " << r.user << " from " << r.address << ": request " << r.request << " took " << r.millis
+               << "ms";
+            benchmark::DoNotOptimize(os.str());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+}
+
+void bm_string_format_to(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        for (auto const& r : records)
+        {
+            std::string str;
+            fmt::format_to(std::back_inserter(str),
+                           "user {} from {}: request {} took {}ms",
+                           r.user,
+                           r.address,
+                           r.request,
+                           r.millis);
+            benchmark::DoNotOptimize(str);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+}
+
+void bm_appender_format_to(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        for (auto const& r : records)
+        {
+            structural::inplace_string<128> str;
+            fmt::format_to(structural::appender(str),
+                           "user {} from {}: request {} took {}ms",
+                           r.user,
+                           r.address,
+                           r.request,
+                           r.millis);
+            benchmark::DoNotOptimize(str);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+}
+
+void bm_appender_format_to_n(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        for (auto const& r : records)
+        {
+            structural::inplace_string<32> str;
+            fmt::format_to_n(structural::appender(str),
+                             str.capacity(),
+                             "user {} from {}: request {} took {}ms",
+                             r.user,
+                             r.address,
+                             r.request,
+                             r.millis);
+            benchmark::DoNotOptimize(str);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+}
+} // namespace
+
+BENCHMARK(bm_ostringstream);
+BENCHMARK(bm_inplace_string_builder);
+BENCHMARK(bm_string_format_to);
+BENCHMARK(bm_appender_format_to);
+BENCHMARK(bm_appender_format_to_n);
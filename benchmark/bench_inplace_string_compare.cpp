@@ -0,0 +1,108 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/inplace_map.hpp"
+#include "structural/inplace_string.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <random>
+#include <string_view>
+
+#include <cstddef>
+
+namespace
+{
+constexpr std::size_t key_count = 512;
+
+// Short keys with long common prefixes, which is where a byte loop is slowest
+template<typename String>
+auto make_keys() -> std::array<String, key_count>
+{
+    constexpr std::array<std::string_view, 4> prefixes{"user.", "user.id.", "session.", "s."};
+
+    std::mt19937                  rng(1);
+    std::array<String, key_count> keys;
+    for (auto& key : keys)
+    {
+        key = String(prefixes[rng() % prefixes.size()].data(), prefixes[rng() % prefixes.size()].size());
+        while (key.size() < key.capacity() - rng() % 6)
+            key.push_back(static_cast<char>('a' + rng() % 3));
+    }
+    return keys;
+}
+
+template<typename String>
+void bm_equal(benchmark::State& state)
+{
+    auto const keys = make_keys<String>();
+    for (auto _ : state)
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i + 1 < key_count; ++i)
+            count += keys[i] == keys[i + 1];
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * (key_count - 1));
+}
+
+template<typename String>
+void bm_less(benchmark::State& state)
+{
+    auto const keys = make_keys<String>();
+    for (auto _ : state)
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i + 1 < key_count; ++i)
+            count += keys[i] < keys[i + 1];
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * (key_count - 1));
+}
+
+template<typename String>
+void bm_map_find(benchmark::State& state)
+{
+    auto const                                      keys = make_keys<String>();
+    structural::inplace_map<String, int, key_count> map;
+    for (std::size_t i = 0; i < key_count; ++i)
+        map.try_emplace(keys[i], static_cast<int>(i));
+    for (auto _ : state)
+    {
+        for (auto const& key : keys)
+            benchmark::DoNotOptimize(map.find(key));
+    }
+    state.SetItemsProcessed(state.iterations() * key_count);
+}
+} // namespace
+
+BENCHMARK(bm_equal<structural::inplace_string<16>>);
+BENCHMARK(bm_equal<structural::inplace_zp_string<16>>);
+BENCHMARK(bm_less<structural::inplace_string<16>>);
+BENCHMARK(bm_less<structural::inplace_zp_string<16>>);
+BENCHMARK(bm_map_find<structural::inplace_string<16>>);
+BENCHMARK(bm_map_find<structural::inplace_zp_string<16>>);
+BENCHMARK(bm_less<structural::inplace_string<48>>);
+BENCHMARK(bm_less<structural::inplace_zp_string<48>>);
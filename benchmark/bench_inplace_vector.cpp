@@ -0,0 +1,102 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/inplace_vector.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <string>
+
+#include <cstddef>
+
+namespace
+{
+// Sorted insertion, as used when an inplace_vector serves as a small flat set.
+template<typename T, std::size_t Capacity, typename Insert>
+void run_sorted_insert(benchmark::State& state, Insert insert)
+{
+    std::mt19937                    rng{42};
+    std::array<T, Capacity>         values;
+    std::uniform_int_distribution<> dist{0, 1'000'000};
+    for (auto& v : values)
+    {
+        if constexpr (std::same_as<T, std::string>)
+            v = std::to_string(dist(rng));
+        else
+            v = static_cast<T>(dist(rng));
+    }
+
+    for (auto _ : state)
+    {
+        structural::inplace_vector<T, Capacity> vec;
+        for (auto const& v : values)
+            insert(vec, std::ranges::upper_bound(vec, v), v);
+        benchmark::DoNotOptimize(vec);
+    }
+    state.SetItemsProcessed(state.iterations() * Capacity);
+}
+
+template<typename T, std::size_t Capacity>
+void bm_sorted_emplace(benchmark::State& state)
+{
+    run_sorted_insert<T, Capacity>(state, [](auto& vec, auto pos, auto const& v) { vec.emplace(pos, v); });
+}
+
+// The previous implementation of emplace: append, then rotate into place.
+template<typename T, std::size_t Capacity>
+void bm_sorted_emplace_rotate(benchmark::State& state)
+{
+    run_sorted_insert<T, Capacity>(state,
+                                   [](auto& vec, auto pos, auto const& v)
+                                   {
+                                       auto const idx = pos - vec.begin();
+                                       vec.emplace_back(v);
+                                       std::ranges::rotate(vec.begin() + idx, vec.end() - 1, vec.end());
+                                   });
+}
+
+template<std::size_t Capacity>
+void bm_range_insert_middle(benchmark::State& state)
+{
+    std::array<int, 8> const chunk{1, 2, 3, 4, 5, 6, 7, 8};
+    for (auto _ : state)
+    {
+        structural::inplace_vector<int, Capacity> vec;
+        while (vec.size() + chunk.size() <= Capacity)
+            vec.insert(vec.begin() + vec.size() / 2, chunk.begin(), chunk.end());
+        benchmark::DoNotOptimize(vec);
+    }
+}
+} // namespace
+
+BENCHMARK(bm_sorted_emplace<int, 16>);
+BENCHMARK(bm_sorted_emplace_rotate<int, 16>);
+BENCHMARK(bm_sorted_emplace<int, 256>);
+BENCHMARK(bm_sorted_emplace_rotate<int, 256>);
+BENCHMARK(bm_sorted_emplace<std::string, 64>);
+BENCHMARK(bm_sorted_emplace_rotate<std::string, 64>);
+BENCHMARK(bm_range_insert_middle<256>);
@@ -0,0 +1,191 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/named_bitset.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include <cstddef>
+#include <cstdint>
+
+STRUCTURAL_MAKE_NAMED_BITSET(flags64,
+                             flag64_set,
+                             flag000, flag001, flag002, flag003, flag004, flag005, flag006, flag007, flag008,
+                             flag009, flag010, flag011, flag012, flag013, flag014, flag015, flag016, flag017,
+                             flag018, flag019, flag020, flag021, flag022, flag023, flag024, flag025, flag026,
+                             flag027, flag028, flag029, flag030, flag031, flag032, flag033, flag034, flag035,
+                             flag036, flag037, flag038, flag039, flag040, flag041, flag042, flag043, flag044,
+                             flag045, flag046, flag047, flag048, flag049, flag050, flag051, flag052, flag053,
+                             flag054, flag055, flag056, flag057, flag058, flag059, flag060, flag061, flag062,
+                             flag063)
+STRUCTURAL_MAKE_NAMED_BITSET(flags256,
+                             flag256_set,
+                             flag000, flag001, flag002, flag003, flag004, flag005, flag006, flag007, flag008,
+                             flag009, flag010, flag011, flag012, flag013, flag014, flag015, flag016, flag017,
+                             flag018, flag019, flag020, flag021, flag022, flag023, flag024, flag025, flag026,
+                             flag027, flag028, flag029, flag030, flag031, flag032, flag033, flag034, flag035,
+                             flag036, flag037, flag038, flag039, flag040, flag041, flag042, flag043, flag044,
+                             flag045, flag046, flag047, flag048, flag049, flag050, flag051, flag052, flag053,
+                             flag054, flag055, flag056, flag057, flag058, flag059, flag060, flag061, flag062,
+                             flag063, flag064, flag065, flag066, flag067, flag068, flag069, flag070, flag071,
+                             flag072, flag073, flag074, flag075, flag076, flag077, flag078, flag079, flag080,
+                             flag081, flag082, flag083, flag084, flag085, flag086, flag087, flag088, flag089,
+                             flag090, flag091, flag092, flag093, flag094, flag095, flag096, flag097, flag098,
+                             flag099, flag100, flag101, flag102, flag103, flag104, flag105, flag106, flag107,
+                             flag108, flag109, flag110, flag111, flag112, flag113, flag114, flag115, flag116,
+                             flag117, flag118, flag119, flag120, flag121, flag122, flag123, flag124, flag125,
+                             flag126, flag127, flag128, flag129, flag130, flag131, flag132, flag133, flag134,
+                             flag135, flag136, flag137, flag138, flag139, flag140, flag141, flag142, flag143,
+                             flag144, flag145, flag146, flag147, flag148, flag149, flag150, flag151, flag152,
+                             flag153, flag154, flag155, flag156, flag157, flag158, flag159, flag160, flag161,
+                             flag162, flag163, flag164, flag165, flag166, flag167, flag168, flag169, flag170,
+                             flag171, flag172, flag173, flag174, flag175, flag176, flag177, flag178, flag179,
+                             flag180, flag181, flag182, flag183, flag184, flag185, flag186, flag187, flag188,
+                             flag189, flag190, flag191, flag192, flag193, flag194, flag195, flag196, flag197,
+                             flag198, flag199, flag200, flag201, flag202, flag203, flag204, flag205, flag206,
+                             flag207, flag208, flag209, flag210, flag211, flag212, flag213, flag214, flag215,
+                             flag216, flag217, flag218, flag219, flag220, flag221, flag222, flag223, flag224,
+                             flag225, flag226, flag227, flag228, flag229, flag230, flag231, flag232, flag233,
+                             flag234, flag235, flag236, flag237, flag238, flag239, flag240, flag241, flag242,
+                             flag243, flag244, flag245, flag246, flag247, flag248, flag249, flag250, flag251,
+                             flag252, flag253, flag254, flag255)
+
+namespace
+{
+template<typename Enum, std::size_t N>
+auto make_enums(unsigned seed) -> std::array<Enum, N>
+{
+    std::mt19937        rng(seed);
+    std::array<Enum, N> result;
+    for (auto& e : result)
+        e = static_cast<Enum>(rng() % N);
+    return result;
+}
+
+template<typename Enum, std::size_t N>
+void bm_to_string_view(benchmark::State& state)
+{
+    auto const enums = make_enums<Enum, N>(1);
+    for (auto _ : state)
+    {
+        std::size_t size = 0;
+        for (Enum const e : enums)
+            size += to_string_view(e).size();
+        benchmark::DoNotOptimize(size);
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+}
+
+template<typename Enum, std::size_t N>
+void bm_from_string_view(benchmark::State& state)
+{
+    std::array<std::string_view, N> names;
+    std::ranges::transform(make_enums<Enum, N>(1), names.begin(), [](Enum e) { return to_string_view(e); });
+    for (auto _ : state)
+    {
+        std::size_t sum = 0;
+        for (std::string_view const name : names)
+            sum += std::size_t(*structural::from_string_view<Enum>(name));
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+}
+
+// What parsing an enum name amounts to without a lookup table
+template<typename Enum, std::size_t N>
+void bm_from_string_view_linear(benchmark::State& state)
+{
+    std::array<std::string_view, N> names;
+    std::ranges::transform(make_enums<Enum, N>(1), names.begin(), [](Enum e) { return to_string_view(e); });
+    for (auto _ : state)
+    {
+        std::size_t sum = 0;
+        for (std::string_view const name : names)
+        {
+            std::size_t i = 0;
+            while (i < N && to_string_view(static_cast<Enum>(i)) != name)
+                ++i;
+            sum += i;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+}
+
+// The benchmark argument is the number of set flags
+template<typename Bitset, typename Enum, std::size_t N>
+auto make_flags(std::int64_t count) -> Bitset
+{
+    Bitset bs;
+    for (Enum const e : make_enums<Enum, N>(1))
+    {
+        if (std::int64_t(bs.count()) == count)
+            break;
+        bs.set(e);
+    }
+    return bs;
+}
+
+template<typename Bitset, typename Enum, std::size_t N>
+void bm_flags_to_string(benchmark::State& state)
+{
+    auto const bs = make_flags<Bitset, Enum, N>(state.range(0));
+    for (auto _ : state)
+    {
+        auto str = bs.to_string();
+        benchmark::DoNotOptimize(str.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Bitset, typename Enum, std::size_t N>
+void bm_flags_to_inplace_string(benchmark::State& state)
+{
+    auto const bs = make_flags<Bitset, Enum, N>(state.range(0));
+    for (auto _ : state)
+    {
+        auto str = bs.to_inplace_string();
+        benchmark::DoNotOptimize(str.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+BENCHMARK(bm_to_string_view<flags64, 64>);
+BENCHMARK(bm_to_string_view<flags256, 256>);
+BENCHMARK(bm_from_string_view<flags64, 64>);
+BENCHMARK(bm_from_string_view<flags256, 256>);
+BENCHMARK(bm_from_string_view_linear<flags64, 64>);
+BENCHMARK(bm_from_string_view_linear<flags256, 256>);
+BENCHMARK(bm_flags_to_string<flag64_set, flags64, 64>)->Arg(4)->Arg(32);
+BENCHMARK(bm_flags_to_string<flag256_set, flags256, 256>)->Arg(4)->Arg(128);
+BENCHMARK(bm_flags_to_inplace_string<flag64_set, flags64, 64>)->Arg(4)->Arg(32);
+BENCHMARK(bm_flags_to_inplace_string<flag256_set, flags256, 256>)->Arg(4)->Arg(128);
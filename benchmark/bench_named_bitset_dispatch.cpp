@@ -0,0 +1,293 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/named_bitset_dispatch.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <memory>
+#include <random>
+
+#include <cstddef>
+#include <cstdint>
+
+STRUCTURAL_MAKE_NAMED_BITSET(request_bits, request_flags, get, head, post, put, cached, gzip, chunked, keep_alive)
+STRUCTURAL_MAKE_NAMED_BITSET(wide_bits,
+                             wide_flags,
+                             flag000, flag001, flag002, flag003, flag004, flag005, flag006, flag007, flag008,
+                             flag009, flag010, flag011, flag012, flag013, flag014, flag015, flag016, flag017,
+                             flag018, flag019, flag020, flag021, flag022, flag023, flag024, flag025, flag026,
+                             flag027, flag028, flag029, flag030, flag031, flag032, flag033, flag034, flag035,
+                             flag036, flag037, flag038, flag039, flag040, flag041, flag042, flag043, flag044,
+                             flag045, flag046, flag047, flag048, flag049, flag050, flag051, flag052, flag053,
+                             flag054, flag055, flag056, flag057, flag058, flag059, flag060, flag061, flag062,
+                             flag063)
+
+namespace
+{
+// Far more inputs than a branch predictor can learn, as it would with repeated passes over a few thousand
+constexpr std::size_t input_count = 65536;
+
+// Each flag is set with probability 1/2, so the branches of an if-chain are unpredictable
+template<typename Bitset>
+auto make_inputs() -> std::unique_ptr<std::array<Bitset, input_count>>
+{
+    std::mt19937_64 rng(1);
+    auto            result = std::make_unique<std::array<Bitset, input_count>>();
+    for (auto& bs : *result)
+    {
+        std::uint64_t const word = rng();
+        for (std::size_t i = 0; i < Bitset::size(); ++i)
+        {
+            if ((word >> i) & 1)
+                bs.bits.set(i);
+        }
+    }
+    return result;
+}
+
+// Handlers count the requests they see. They stand for real work, so they are not inlined, which also keeps the
+// compiler from turning the if-chain into branch-free code.
+using counters = std::array<std::uint64_t, 16>;
+
+template<std::size_t I>
+[[gnu::noinline]] void handle(counters& n)
+{
+    ++n[I];
+}
+
+void route_by_if(request_flags r, counters& n)
+{
+    using enum request_bits;
+    if (r.test(get) && r.test(cached))
+        handle<0>(n);
+    else if (r.test(get) && r.test(gzip))
+        handle<1>(n);
+    else if (r.test(get))
+        handle<2>(n);
+    else if (r.test(head) && !r.test(keep_alive))
+        handle<3>(n);
+    else if (r.test(post) && r.test(chunked))
+        handle<4>(n);
+    else if (r.test(post) || r.test(put))
+        handle<5>(n);
+    else
+        handle<6>(n);
+}
+
+void route_by_dispatch(request_flags r, counters& n)
+{
+    using namespace structural;
+    using enum request_bits;
+    dispatch(r,
+             when<get | cached>([&] { handle<0>(n); }),
+             when<get | gzip>([&] { handle<1>(n); }),
+             when<get>([&] { handle<2>(n); }),
+             when<head, keep_alive>([&] { handle<3>(n); }),
+             when<post | chunked>([&] { handle<4>(n); }),
+             when<post>([&] { handle<5>(n); }),
+             when<put>([&] { handle<5>(n); }),
+             otherwise([&] { handle<6>(n); }));
+}
+
+// The same cases on flags scattered over a 64-flag bitset
+void route_by_if(wide_flags f, counters& n)
+{
+    using enum wide_bits;
+    if (f.test(flag003) && f.test(flag041))
+        handle<0>(n);
+    else if (f.test(flag003) && f.test(flag017))
+        handle<1>(n);
+    else if (f.test(flag003))
+        handle<2>(n);
+    else if (f.test(flag009) && !f.test(flag060))
+        handle<3>(n);
+    else if (f.test(flag022) && f.test(flag035))
+        handle<4>(n);
+    else if (f.test(flag022) || f.test(flag050))
+        handle<5>(n);
+    else
+        handle<6>(n);
+}
+
+void route_by_dispatch(wide_flags f, counters& n)
+{
+    using namespace structural;
+    using enum wide_bits;
+    dispatch(f,
+             when<flag003 | flag041>([&] { handle<0>(n); }),
+             when<flag003 | flag017>([&] { handle<1>(n); }),
+             when<flag003>([&] { handle<2>(n); }),
+             when<flag009, flag060>([&] { handle<3>(n); }),
+             when<flag022 | flag035>([&] { handle<4>(n); }),
+             when<flag022>([&] { handle<5>(n); }),
+             when<flag050>([&] { handle<5>(n); }),
+             otherwise([&] { handle<6>(n); }));
+}
+
+// One case per combination of four flags, so that every case is about as likely
+void classify_by_if(request_flags r, counters& n)
+{
+    using enum request_bits;
+    if (r.test(get) && r.test(head) && r.test(post) && r.test(put))
+        handle<0>(n);
+    else if (r.test(get) && r.test(head) && r.test(post))
+        handle<1>(n);
+    else if (r.test(get) && r.test(head) && r.test(put))
+        handle<2>(n);
+    else if (r.test(get) && r.test(head))
+        handle<3>(n);
+    else if (r.test(get) && r.test(post) && r.test(put))
+        handle<4>(n);
+    else if (r.test(get) && r.test(post))
+        handle<5>(n);
+    else if (r.test(get) && r.test(put))
+        handle<6>(n);
+    else if (r.test(get))
+        handle<7>(n);
+    else if (r.test(head) && r.test(post) && r.test(put))
+        handle<8>(n);
+    else if (r.test(head) && r.test(post))
+        handle<9>(n);
+    else if (r.test(head) && r.test(put))
+        handle<10>(n);
+    else if (r.test(head))
+        handle<11>(n);
+    else if (r.test(post) && r.test(put))
+        handle<12>(n);
+    else if (r.test(post))
+        handle<13>(n);
+    else if (r.test(put))
+        handle<14>(n);
+    else
+        handle<15>(n);
+}
+
+void classify_by_dispatch(request_flags r, counters& n)
+{
+    using namespace structural;
+    using enum request_bits;
+    dispatch(r,
+             when<get | head | post | put>([&] { handle<0>(n); }),
+             when<get | head | post>([&] { handle<1>(n); }),
+             when<get | head | put>([&] { handle<2>(n); }),
+             when<get | head>([&] { handle<3>(n); }),
+             when<get | post | put>([&] { handle<4>(n); }),
+             when<get | post>([&] { handle<5>(n); }),
+             when<get | put>([&] { handle<6>(n); }),
+             when<get>([&] { handle<7>(n); }),
+             when<head | post | put>([&] { handle<8>(n); }),
+             when<head | post>([&] { handle<9>(n); }),
+             when<head | put>([&] { handle<10>(n); }),
+             when<head>([&] { handle<11>(n); }),
+             when<post | put>([&] { handle<12>(n); }),
+             when<post>([&] { handle<13>(n); }),
+             when<put>([&] { handle<14>(n); }),
+             otherwise([&] { handle<15>(n); }));
+}
+
+void classify_by_if(wide_flags f, counters& n)
+{
+    using enum wide_bits;
+    if (f.test(flag003) && f.test(flag017) && f.test(flag041) && f.test(flag060))
+        handle<0>(n);
+    else if (f.test(flag003) && f.test(flag017) && f.test(flag041))
+        handle<1>(n);
+    else if (f.test(flag003) && f.test(flag017) && f.test(flag060))
+        handle<2>(n);
+    else if (f.test(flag003) && f.test(flag017))
+        handle<3>(n);
+    else if (f.test(flag003) && f.test(flag041) && f.test(flag060))
+        handle<4>(n);
+    else if (f.test(flag003) && f.test(flag041))
+        handle<5>(n);
+    else if (f.test(flag003) && f.test(flag060))
+        handle<6>(n);
+    else if (f.test(flag003))
+        handle<7>(n);
+    else if (f.test(flag017) && f.test(flag041) && f.test(flag060))
+        handle<8>(n);
+    else if (f.test(flag017) && f.test(flag041))
+        handle<9>(n);
+    else if (f.test(flag017) && f.test(flag060))
+        handle<10>(n);
+    else if (f.test(flag017))
+        handle<11>(n);
+    else if (f.test(flag041) && f.test(flag060))
+        handle<12>(n);
+    else if (f.test(flag041))
+        handle<13>(n);
+    else if (f.test(flag060))
+        handle<14>(n);
+    else
+        handle<15>(n);
+}
+
+void classify_by_dispatch(wide_flags f, counters& n)
+{
+    using namespace structural;
+    using enum wide_bits;
+    dispatch(f,
+             when<flag003 | flag017 | flag041 | flag060>([&] { handle<0>(n); }),
+             when<flag003 | flag017 | flag041>([&] { handle<1>(n); }),
+             when<flag003 | flag017 | flag060>([&] { handle<2>(n); }),
+             when<flag003 | flag017>([&] { handle<3>(n); }),
+             when<flag003 | flag041 | flag060>([&] { handle<4>(n); }),
+             when<flag003 | flag041>([&] { handle<5>(n); }),
+             when<flag003 | flag060>([&] { handle<6>(n); }),
+             when<flag003>([&] { handle<7>(n); }),
+             when<flag017 | flag041 | flag060>([&] { handle<8>(n); }),
+             when<flag017 | flag041>([&] { handle<9>(n); }),
+             when<flag017 | flag060>([&] { handle<10>(n); }),
+             when<flag017>([&] { handle<11>(n); }),
+             when<flag041 | flag060>([&] { handle<12>(n); }),
+             when<flag041>([&] { handle<13>(n); }),
+             when<flag060>([&] { handle<14>(n); }),
+             otherwise([&] { handle<15>(n); }));
+}
+
+template<typename Bitset, void (*Fn)(Bitset, counters&)>
+void bm_dispatch(benchmark::State& state)
+{
+    auto const inputs = make_inputs<Bitset>();
+    counters   n{};
+    for (auto _ : state)
+    {
+        for (Bitset const& bs : *inputs)
+            Fn(bs, n);
+        benchmark::DoNotOptimize(n);
+    }
+    state.SetItemsProcessed(state.iterations() * input_count);
+}
+} // namespace
+
+BENCHMARK(bm_dispatch<request_flags, route_by_if>);
+BENCHMARK(bm_dispatch<request_flags, route_by_dispatch>);
+BENCHMARK(bm_dispatch<wide_flags, route_by_if>);
+BENCHMARK(bm_dispatch<wide_flags, route_by_dispatch>);
+BENCHMARK(bm_dispatch<request_flags, classify_by_if>);
+BENCHMARK(bm_dispatch<request_flags, classify_by_dispatch>);
+BENCHMARK(bm_dispatch<wide_flags, classify_by_if>);
+BENCHMARK(bm_dispatch<wide_flags, classify_by_dispatch>);
@@ -0,0 +1,67 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/inplace_vector.hpp"
+#include "structural/small_vector.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+// Strings are kept short enough for the small string optimization, so only the vector itself allocates
+template<typename T>
+auto make_element(int i) -> T
+{
+    if constexpr (std::is_same_v<T, std::string>)
+        return std::string(static_cast<std::size_t>(i % 8) + 1, 'x');
+    else
+        return T(i);
+}
+
+template<typename Vector>
+void bm_fill(benchmark::State& state)
+{
+    auto const n = static_cast<int>(state.range(0));
+    for (auto _ : state)
+    {
+        Vector v;
+        for (int i = 0; i < n; ++i)
+            v.push_back(make_element<typename Vector::value_type>(i));
+        benchmark::DoNotOptimize(v);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+} // namespace
+
+BENCHMARK(bm_fill<std::vector<int>>)->DenseRange(0, 16, 4);
+BENCHMARK(bm_fill<structural::inplace_vector<int, 16>>)->DenseRange(0, 16, 4);
+BENCHMARK(bm_fill<structural::small_vector<int, 8>>)->DenseRange(0, 16, 4);
+BENCHMARK(bm_fill<std::vector<std::string>>)->DenseRange(0, 16, 4);
+BENCHMARK(bm_fill<structural::inplace_vector<std::string, 16>>)->DenseRange(0, 16, 4);
+BENCHMARK(bm_fill<structural::small_vector<std::string, 8>>)->DenseRange(0, 16, 4);
@@ -0,0 +1,144 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/inplace_vector.hpp"
+#include "structural/split.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <ranges>
+#include <string>
+#include <string_view>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+auto make_records() -> std::string
+{
+    std::string records;
+    for (int i = 0; i < 256; ++i)
+    {
+        records += std::to_string(i * 7919);
+        records += ",user-";
+        records += std::to_string(i);
+        records += ",some longer free text field,";
+        records += std::to_string(i % 13);
+        records += ",,last\n";
+    }
+    return records;
+}
+
+void bm_split_ranges_views(benchmark::State& state)
+{
+    auto const records = make_records();
+    for (auto _ : state)
+    {
+        std::size_t total = 0;
+        for (auto&& line : std::string_view(records) | std::views::split('\n'))
+        {
+            for (auto&& field : line | std::views::split(','))
+            {
+                std::string_view const sv(&*field.begin(), static_cast<std::size_t>(std::ranges::distance(field)));
+                total += sv.size();
+            }
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * records.size()));
+}
+
+void bm_split_structural(benchmark::State& state)
+{
+    auto const records = make_records();
+    for (auto _ : state)
+    {
+        std::size_t total = 0;
+        for (auto line : structural::split(records, '\n'))
+            for (auto field : structural::split(line, ','))
+                total += field.size();
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * records.size()));
+}
+
+void bm_split_into_inplace_vector(benchmark::State& state)
+{
+    auto const records = make_records();
+    for (auto _ : state)
+    {
+        std::size_t total = 0;
+        for (auto line : structural::split(records, '\n'))
+        {
+            auto const fields = structural::split_into<structural::inplace_vector<std::string_view, 8>>(line, ',');
+            total += fields.size();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * records.size()));
+}
+
+void bm_tokenize_find_first_of(benchmark::State& state)
+{
+    auto const records = make_records();
+    for (auto _ : state)
+    {
+        std::size_t      total = 0;
+        std::string_view rest  = records;
+        while (true)
+        {
+            auto const begin = rest.find_first_not_of(" ,\n");
+            if (begin == std::string_view::npos)
+                break;
+            rest           = rest.substr(begin);
+            auto const end = std::min(rest.find_first_of(" ,\n"), rest.size());
+            total += end;
+            rest = rest.substr(end);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * records.size()));
+}
+
+void bm_tokenize_structural(benchmark::State& state)
+{
+    auto const records = make_records();
+    for (auto _ : state)
+    {
+        std::size_t total = 0;
+        for (auto token : structural::tokenize(records, " ,\n"))
+            total += token.size();
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * records.size()));
+}
+} // namespace
+
+BENCHMARK(bm_split_ranges_views);
+BENCHMARK(bm_split_structural);
+BENCHMARK(bm_split_into_inplace_vector);
+BENCHMARK(bm_tokenize_find_first_of);
+BENCHMARK(bm_tokenize_structural);
@@ -0,0 +1,111 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/spsc_queue.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <thread>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+struct message
+{
+    std::uint64_t             sequence;
+    std::array<std::byte, 56> payload;
+};
+
+template<std::size_t Capacity>
+void bm_spsc_queue_throughput(benchmark::State& state)
+{
+    auto const batch = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        constexpr std::uint64_t n     = 1'000'000;
+        auto                    queue = std::make_unique<structural::spsc_queue<message, Capacity>>();
+
+        std::thread producer(
+            [&]
+            {
+                std::array<message, 64> buffer{};
+                for (std::uint64_t i = 0; i < n;)
+                {
+                    auto const count = std::min<std::uint64_t>(batch, n - i);
+                    for (std::uint64_t j = 0; j < count; ++j)
+                        buffer[j].sequence = i + j;
+                    i += queue->push_n(buffer.begin(), count);
+                }
+            });
+
+        std::array<message, 64> buffer{};
+        std::uint64_t           received = 0;
+        while (received < n)
+            received += queue->pop_n(buffer.begin(), batch);
+        producer.join();
+        benchmark::DoNotOptimize(buffer);
+        state.SetItemsProcessed(state.items_processed() + n);
+    }
+}
+
+void bm_spsc_queue_round_trip_latency(benchmark::State& state)
+{
+    auto ping = std::make_unique<structural::spsc_queue<message, 64>>();
+    auto pong = std::make_unique<structural::spsc_queue<message, 64>>();
+
+    std::atomic<bool> done{false};
+    std::thread       echo(
+        [&]
+        {
+            while (!done.load(std::memory_order_relaxed))
+                if (auto m = ping->try_pop())
+                    while (!pong->try_push(*m))
+                        ;
+        });
+
+    message m{};
+    for (auto _ : state)
+    {
+        while (!ping->try_push(m))
+            ;
+        std::optional<message> reply;
+        while (!(reply = pong->try_pop()))
+            ;
+        ++m.sequence;
+    }
+    done = true;
+    echo.join();
+}
+} // namespace
+
+BENCHMARK(bm_spsc_queue_throughput<256>)->Arg(1)->Arg(16)->Arg(64)->UseRealTime();
+BENCHMARK(bm_spsc_queue_throughput<4096>)->Arg(1)->Arg(16)->Arg(64)->UseRealTime();
+BENCHMARK(bm_spsc_queue_round_trip_latency)->UseRealTime();
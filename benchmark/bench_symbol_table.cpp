@@ -0,0 +1,113 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/inplace_string.hpp"
+#include "structural/inplace_unordered_map.hpp"
+#include "structural/symbol_table.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <string_view>
+
+#include <cstddef>
+
+namespace
+{
+constexpr std::size_t key_count = 256;
+constexpr std::size_t max_len   = 48;
+
+using raw_key = structural::inplace_string<max_len>;
+using table_t = structural::symbol_table<2 * key_count, max_len>;
+
+// Identifiers of similar length that share long prefixes, like qualified names do
+auto make_identifiers() -> std::array<raw_key, key_count>
+{
+    std::array<raw_key, key_count> result;
+    for (std::size_t i = 0; i < key_count; ++i)
+    {
+        result[i] = "structural::detail::identifier_";
+        result[i].push_back(static_cast<char>('a' + i % 26));
+        result[i].push_back(static_cast<char>('a' + i / 26 % 26));
+    }
+    return result;
+}
+
+void bm_map_lookup_raw_key(benchmark::State& state)
+{
+    auto const identifiers = make_identifiers();
+
+    structural::inplace_unordered_map<raw_key, int, 2 * key_count> map;
+    for (std::size_t i = 0; i < key_count; ++i)
+        map.emplace(identifiers[i], static_cast<int>(i));
+
+    for (auto _ : state)
+    {
+        for (auto const& id : identifiers)
+            benchmark::DoNotOptimize(map.find(id));
+    }
+    state.SetItemsProcessed(state.iterations() * key_count);
+}
+
+void bm_map_lookup_interned_key(benchmark::State& state)
+{
+    auto const identifiers = make_identifiers();
+
+    table_t                                   table;
+    std::array<structural::symbol, key_count> symbols{};
+    for (std::size_t i = 0; i < key_count; ++i)
+        symbols[i] = table.intern(identifiers[i]);
+
+    structural::inplace_unordered_map<structural::symbol, int, 2 * key_count> map;
+    for (std::size_t i = 0; i < key_count; ++i)
+        map.emplace(symbols[i], static_cast<int>(i));
+
+    for (auto _ : state)
+    {
+        for (auto const s : symbols)
+            benchmark::DoNotOptimize(map.find(s));
+    }
+    state.SetItemsProcessed(state.iterations() * key_count);
+}
+
+void bm_intern(benchmark::State& state)
+{
+    auto const identifiers = make_identifiers();
+
+    table_t table;
+    for (auto const& id : identifiers)
+        table.intern(id);
+
+    for (auto _ : state)
+    {
+        for (auto const& id : identifiers)
+            benchmark::DoNotOptimize(table.find(id));
+    }
+    state.SetItemsProcessed(state.iterations() * key_count);
+}
+} // namespace
+
+BENCHMARK(bm_map_lookup_raw_key);
+BENCHMARK(bm_map_lookup_interned_key);
+BENCHMARK(bm_intern);
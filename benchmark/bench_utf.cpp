@@ -0,0 +1,131 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/inplace_string.hpp"
+#include "structural/utf.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <string_view>
+
+#include <cstddef>
+
+namespace
+{
+constexpr std::size_t corpus_capacity = 4096;
+
+using corpus_t = structural::inplace_u8string<corpus_capacity>;
+
+constexpr std::u8string_view ascii_heavy_text
+    = u8"The café on the corner serves crème brûlée every Friday. Most of this text is plain ASCII, with the "
+      u8"occasional accented letter, which is what log lines, identifiers and most field values look like. ";
+
+constexpr std::u8string_view cjk_heavy_text
+    = u8"東京都の天気は晴れ、最高気温は二十五度の予想です。北京市今天多云，夜间有小雨。서울은 오늘 맑고 "
+      u8"따뜻하겠습니다。";
+
+auto make_corpus(std::u8string_view text) -> corpus_t
+{
+    corpus_t result;
+    while (result.size() + text.size() <= corpus_capacity)
+        result.append(text.data(), text.size());
+    return result;
+}
+
+corpus_t const ascii_heavy = make_corpus(ascii_heavy_text);
+corpus_t const cjk_heavy   = make_corpus(cjk_heavy_text);
+
+auto corpus_arg(benchmark::State const& state) -> corpus_t const&
+{
+    return state.range(0) == 0 ? ascii_heavy : cjk_heavy;
+}
+
+void bm_validate_scalar(benchmark::State& state)
+{
+    auto const& corpus = corpus_arg(state);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(structural::detail::utf::validate_scalar(corpus.data(), corpus.size()));
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+}
+
+void bm_validate_utf8(benchmark::State& state)
+{
+    auto const& corpus = corpus_arg(state);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(structural::validate_utf8(corpus));
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+}
+
+void bm_utf8_length_scalar(benchmark::State& state)
+{
+    auto const& corpus = corpus_arg(state);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(structural::detail::utf::utf8_length_scalar(corpus.data(), corpus.size()));
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+}
+
+void bm_utf8_length(benchmark::State& state)
+{
+    auto const& corpus = corpus_arg(state);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(structural::utf8_length(corpus));
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+}
+
+void bm_transcode_scalar(benchmark::State& state)
+{
+    auto const&                                   corpus = corpus_arg(state);
+    structural::inplace_u16string<corpus_capacity> result;
+    for (auto _ : state)
+    {
+        bool const valid = structural::detail::utf::validate_scalar(corpus.data(), corpus.size());
+        result.resize_and_overwrite(corpus.size(),
+                                    [&](char16_t* out, std::size_t)
+                                    {
+                                        return structural::detail::utf::transcode_scalar(corpus.data(),
+                                                                                         corpus.size(),
+                                                                                         out)
+                                               - out;
+                                    });
+        benchmark::DoNotOptimize(valid);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+}
+
+void bm_transcode(benchmark::State& state)
+{
+    auto const& corpus = corpus_arg(state);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(structural::transcode<char16_t>(corpus));
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+}
+} // namespace
+
+BENCHMARK(bm_validate_scalar)->ArgName("cjk")->Arg(0)->Arg(1);
+BENCHMARK(bm_validate_utf8)->ArgName("cjk")->Arg(0)->Arg(1);
+BENCHMARK(bm_utf8_length_scalar)->ArgName("cjk")->Arg(0)->Arg(1);
+BENCHMARK(bm_utf8_length)->ArgName("cjk")->Arg(0)->Arg(1);
+BENCHMARK(bm_transcode_scalar)->ArgName("cjk")->Arg(0)->Arg(1);
+BENCHMARK(bm_transcode)->ArgName("cjk")->Arg(0)->Arg(1);
@@ -0,0 +1,156 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_ASCII_CASE_INSENSITIVE_HPP
+#define STRUCTURAL_ASCII_CASE_INSENSITIVE_HPP
+
+#include "structural/basic_inplace_string.hpp"
+#include "structural/detail/ascii_case_folding.hpp"
+#include "structural/hash.hpp"
+
+#include <compare>
+#include <concepts>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include <cstddef>
+
+namespace structural
+{
+/// Character traits that compare ASCII letters case-insensitively
+///
+/// # Notes
+/// - Other characters compare like they do with `std::char_traits<CharT>`. In particular, UTF-8 strings compare
+///   equal if they differ only in the case of ASCII letters.
+/// - Case-insensitive strings order by their lowercase form.
+template<typename CharT>
+struct ascii_ci_traits : std::char_traits<CharT>
+{
+    using comparison_category = std::weak_ordering;
+
+    static constexpr auto eq(CharT a, CharT b) noexcept -> bool
+    {
+        return detail::ascii_case_folding::to_lower(a) == detail::ascii_case_folding::to_lower(b);
+    }
+
+    static constexpr auto lt(CharT a, CharT b) noexcept -> bool
+    {
+        return std::char_traits<CharT>::lt(detail::ascii_case_folding::to_lower(a),
+                                           detail::ascii_case_folding::to_lower(b));
+    }
+
+    static constexpr auto compare(CharT const* s1, CharT const* s2, std::size_t count) noexcept -> int
+    {
+        std::size_t i = 0;
+        if constexpr (std::same_as<CharT, char>)
+            i = detail::ascii_case_folding::equal_words(s1, s2, count);
+        for (; i < count; ++i)
+        {
+            if (!eq(s1[i], s2[i]))
+                return lt(s1[i], s2[i]) ? -1 : 1;
+        }
+        return 0;
+    }
+
+    static constexpr auto find(CharT const* p, std::size_t count, CharT const& ch) noexcept -> CharT const*
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (eq(p[i], ch))
+                return p + i;
+        }
+        return nullptr;
+    }
+};
+
+/// A string that compares ASCII letters case-insensitively
+template<std::size_t Capacity>
+using inplace_ci_string = basic_inplace_string<char, Capacity, ascii_ci_traits<char>>;
+
+namespace detail
+{
+template<typename T>
+concept ascii_ci_string_like = std::convertible_to<T const&, std::string_view>
+                               || std::convertible_to<T const&, std::basic_string_view<char, ascii_ci_traits<char>>>;
+
+template<ascii_ci_string_like T>
+constexpr auto as_plain_string_view(T const& str) -> std::string_view
+{
+    if constexpr (std::convertible_to<T const&, std::string_view>)
+        return str;
+    else
+    {
+        std::basic_string_view<char, ascii_ci_traits<char>> const sv = str;
+        return {sv.data(), sv.size()};
+    }
+}
+} // namespace detail
+
+/// Hash function that ignores the case of ASCII letters, consistent with ascii_ci_equal
+///
+/// Accepts anything convertible to `std::string_view`, or to a string view with `ascii_ci_traits<char>`. Transparent,
+/// so containers using it can be queried with any of those without constructing a key.
+struct ascii_ci_hash
+{
+    using is_transparent = void;
+
+    template<detail::ascii_ci_string_like T>
+    constexpr auto operator()(T const& str) const -> std::size_t
+    {
+        return detail::ascii_case_folding::hash(detail::as_plain_string_view(str));
+    }
+};
+
+/// Equality comparison that ignores the case of ASCII letters, consistent with ascii_ci_hash
+///
+/// Accepts anything convertible to `std::string_view`, or to a string view with `ascii_ci_traits<char>`. Transparent,
+/// so containers using it can be queried with any of those without constructing a key.
+struct ascii_ci_equal
+{
+    using is_transparent = void;
+
+    template<detail::ascii_ci_string_like T, detail::ascii_ci_string_like U>
+    constexpr auto operator()(T const& lhs, U const& rhs) const -> bool
+    {
+        return detail::ascii_case_folding::equal(detail::as_plain_string_view(lhs), detail::as_plain_string_view(rhs));
+    }
+};
+
+template<std::size_t Capacity>
+struct hash<basic_inplace_string<char, Capacity, ascii_ci_traits<char>>> : ascii_ci_hash
+{
+};
+} // namespace structural
+
+namespace std
+{
+template<std::size_t Capacity>
+struct hash<structural::basic_inplace_string<char, Capacity, structural::ascii_ci_traits<char>>>
+    : structural::ascii_ci_hash
+{
+};
+} // namespace std
+
+#endif // STRUCTURAL_ASCII_CASE_INSENSITIVE_HPP
@@ -0,0 +1,187 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_ATOMIC_BITSET_HPP
+#define STRUCTURAL_ATOMIC_BITSET_HPP
+
+#include "structural/bitset.hpp"
+
+#include <ctrx/contracts.hpp>
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+
+#include <climits>
+#include <cstddef>
+
+namespace structural
+{
+/// Fixed-size sequence of N bits that can be read and modified concurrently from multiple threads without locking.
+///
+/// The bits use the same chunk layout as bitset<N, Chunk>, except that every chunk is a std::atomic. Single-bit
+/// operations are atomic. Operations taking a mask or producing a snapshot are atomic for each chunk, but not across
+/// chunks; as long as the affected bits share a chunk (always the case for N <= 64), they are atomic as a whole.
+///
+/// # Notes
+/// Like spsc_queue, this type is neither structural nor usable in constant expressions. Use snapshot() to obtain a
+/// structural bitset and the bitset constructor or store() to go the other way.
+template<std::size_t N, std::unsigned_integral Chunk = detail::default_bitset_chunk_t<N>>
+struct atomic_bitset
+{
+    using chunk_t     = Chunk;
+    using bitset_type = bitset<N, Chunk>;
+
+    static constexpr std::size_t npos = bitset_type::npos;
+
+    atomic_bitset() noexcept = default;
+    explicit atomic_bitset(bitset_type const& bs) noexcept { store(bs, std::memory_order_relaxed); }
+
+    atomic_bitset(atomic_bitset const&)                    = delete;
+    atomic_bitset(atomic_bitset&&)                         = delete;
+    auto operator=(atomic_bitset const&) -> atomic_bitset& = delete;
+    auto operator=(atomic_bitset&&) -> atomic_bitset&      = delete;
+
+    [[nodiscard]] static constexpr auto size() noexcept { return N; }
+
+    /// Copies the current value of all bits into a plain bitset
+    [[nodiscard]] auto snapshot(std::memory_order order = std::memory_order_seq_cst) const noexcept -> bitset_type
+    {
+        bitset_type result;
+        for (std::size_t i = 0; i < chunks.size(); ++i)
+            result.chunks[i] = chunks[i].load(order);
+        return result;
+    }
+
+    /// Equivalent to snapshot()
+    explicit operator bitset_type() const noexcept { return snapshot(); }
+
+    /// Overwrites all bits with the ones of bs
+    void store(bitset_type const& bs, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        for (std::size_t i = 0; i < chunks.size(); ++i)
+            chunks[i].store(bs.chunks[i], order);
+    }
+
+    [[nodiscard]] auto test(std::size_t pos, std::memory_order order = std::memory_order_seq_cst) const noexcept -> bool
+    {
+        return (chunk_for(pos).load(order) & bit_for(pos)) != 0;
+    }
+
+    void set(std::size_t pos, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        chunk_for(pos).fetch_or(bit_for(pos), order);
+    }
+
+    void reset(std::size_t pos, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        chunk_for(pos).fetch_and(chunk_t(~bit_for(pos)), order);
+    }
+
+    void flip(std::size_t pos, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        chunk_for(pos).fetch_xor(bit_for(pos), order);
+    }
+
+    /// Sets the bit at pos and returns its previous value
+    auto test_and_set(std::size_t pos, std::memory_order order = std::memory_order_seq_cst) noexcept -> bool
+    {
+        return (chunk_for(pos).fetch_or(bit_for(pos), order) & bit_for(pos)) != 0;
+    }
+
+    /// Resets the bit at pos and returns its previous value
+    auto test_and_reset(std::size_t pos, std::memory_order order = std::memory_order_seq_cst) noexcept -> bool
+    {
+        return (chunk_for(pos).fetch_and(chunk_t(~bit_for(pos)), order) & bit_for(pos)) != 0;
+    }
+
+    /// Sets all bits that are set in mask and returns the previous value of all bits
+    auto fetch_set(bitset_type const& mask, std::memory_order order = std::memory_order_seq_cst) noexcept
+        -> bitset_type
+    {
+        bitset_type previous;
+        for (std::size_t i = 0; i < chunks.size(); ++i)
+            previous.chunks[i] = mask.chunks[i] != 0 ? chunks[i].fetch_or(mask.chunks[i], order)
+                                                     : chunks[i].load(order);
+        return previous;
+    }
+
+    /// Resets all bits that are set in mask and returns the previous value of all bits
+    auto fetch_reset(bitset_type const& mask, std::memory_order order = std::memory_order_seq_cst) noexcept
+        -> bitset_type
+    {
+        bitset_type previous;
+        for (std::size_t i = 0; i < chunks.size(); ++i)
+            previous.chunks[i] = mask.chunks[i] != 0 ? chunks[i].fetch_and(chunk_t(~mask.chunks[i]), order)
+                                                     : chunks[i].load(order);
+        return previous;
+    }
+
+    /// Finds the lowest unset bit and sets it
+    ///
+    /// # Return value
+    /// The index of the bit that was set, or npos if all bits were set already.
+    ///
+    /// # Notes
+    /// No two concurrent callers can claim the same bit, which makes this suitable for lock-free slot allocation.
+    auto find_first_unset_and_set(std::memory_order order = std::memory_order_seq_cst) noexcept -> std::size_t
+    {
+        for (std::size_t i = 0; i < chunks.size(); ++i)
+        {
+            auto&      chunk = chunks[chunks.size() - i - 1];
+            auto const full  = i + 1 == chunks.size() ? detail::tail_mask<N, chunk_t> : chunk_t(~chunk_t{0});
+            auto       value = chunk.load(std::memory_order_relaxed);
+            while (value != full)
+            {
+                auto const bit = chunk_t(~value & (value + 1u));
+                if (chunk.compare_exchange_weak(value, value | bit, order, std::memory_order_relaxed))
+                    return i * bits_per_chunk + std::countr_zero(bit);
+            }
+        }
+        return npos;
+    }
+
+    std::array<std::atomic<chunk_t>, detail::chunk_size<N, chunk_t>> chunks{};
+
+private:
+    static constexpr std::size_t bits_per_chunk = detail::bits_per_chunk<chunk_t>;
+
+    auto chunk_for(std::size_t pos) noexcept -> std::atomic<chunk_t>&
+    {
+        CTRX_PRECONDITION(pos < N);
+        return chunks[chunks.size() - pos / bits_per_chunk - 1];
+    }
+
+    auto chunk_for(std::size_t pos) const noexcept -> std::atomic<chunk_t> const&
+    {
+        CTRX_PRECONDITION(pos < N);
+        return chunks[chunks.size() - pos / bits_per_chunk - 1];
+    }
+
+    static auto bit_for(std::size_t pos) noexcept -> chunk_t { return chunk_t(chunk_t{1} << (pos % bits_per_chunk)); }
+};
+} // namespace structural
+
+#endif // STRUCTURAL_ATOMIC_BITSET_HPP
@@ -0,0 +1,143 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_ATOMIC_NAMED_BITSET_HPP
+#define STRUCTURAL_ATOMIC_NAMED_BITSET_HPP
+
+#include "structural/atomic_bitset.hpp"
+#include "structural/detail/to_underlying.hpp"
+#include "structural/named_bitset.hpp"
+
+#include <atomic>
+#include <optional>
+#include <type_traits>
+
+#include <cstddef>
+
+namespace structural
+{
+/// Set of flags of an enum created with STRUCTURAL_MAKE_NAMED_BITSET that can be read and modified concurrently from
+/// multiple threads without locking.
+///
+/// # Notes
+/// See atomic_bitset for the atomicity guarantees. Use snapshot() to obtain a named_bitset and the named_bitset
+/// constructor or store() to go the other way.
+template<typename Enum, std::size_t N>
+    requires(std::is_enum_v<Enum>)
+struct atomic_named_bitset
+{
+    using bitset_type = named_bitset<Enum, N>;
+
+    atomic_named_bitset() noexcept = default;
+    explicit atomic_named_bitset(bitset_type const& bs) noexcept
+        : bits(bs.bits)
+    {
+    }
+
+    [[nodiscard]] static constexpr auto size() noexcept { return N; }
+
+    /// Copies the current value of all flags into a plain named_bitset
+    [[nodiscard]] auto snapshot(std::memory_order order = std::memory_order_seq_cst) const noexcept -> bitset_type
+    {
+        bitset_type result;
+        result.bits = bits.snapshot(order);
+        return result;
+    }
+
+    /// Equivalent to snapshot()
+    explicit operator bitset_type() const noexcept { return snapshot(); }
+
+    /// Overwrites all flags with the ones of bs
+    void store(bitset_type const& bs, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        bits.store(bs.bits, order);
+    }
+
+    [[nodiscard]] auto test(Enum e, std::memory_order order = std::memory_order_seq_cst) const noexcept -> bool
+    {
+        return bits.test(detail::to_underlying(e), order);
+    }
+
+    void set(Enum e, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        bits.set(detail::to_underlying(e), order);
+    }
+
+    void reset(Enum e, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        bits.reset(detail::to_underlying(e), order);
+    }
+
+    void flip(Enum e, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        bits.flip(detail::to_underlying(e), order);
+    }
+
+    /// Sets the flag e and returns its previous value
+    auto test_and_set(Enum e, std::memory_order order = std::memory_order_seq_cst) noexcept -> bool
+    {
+        return bits.test_and_set(detail::to_underlying(e), order);
+    }
+
+    /// Resets the flag e and returns its previous value
+    auto test_and_reset(Enum e, std::memory_order order = std::memory_order_seq_cst) noexcept -> bool
+    {
+        return bits.test_and_reset(detail::to_underlying(e), order);
+    }
+
+    /// Sets all flags that are set in mask and returns the previous value of all flags
+    auto fetch_set(bitset_type const& mask, std::memory_order order = std::memory_order_seq_cst) noexcept
+        -> bitset_type
+    {
+        bitset_type previous;
+        previous.bits = bits.fetch_set(mask.bits, order);
+        return previous;
+    }
+
+    /// Resets all flags that are set in mask and returns the previous value of all flags
+    auto fetch_reset(bitset_type const& mask, std::memory_order order = std::memory_order_seq_cst) noexcept
+        -> bitset_type
+    {
+        bitset_type previous;
+        previous.bits = bits.fetch_reset(mask.bits, order);
+        return previous;
+    }
+
+    /// Finds the lowest unset flag and sets it
+    ///
+    /// # Return value
+    /// The flag that was set, or nullopt if all flags were set already.
+    auto find_first_unset_and_set(std::memory_order order = std::memory_order_seq_cst) noexcept -> std::optional<Enum>
+    {
+        auto const pos = bits.find_first_unset_and_set(order);
+        if (pos == atomic_bitset<N>::npos)
+            return std::nullopt;
+        return static_cast<Enum>(pos);
+    }
+
+    atomic_bitset<N> bits;
+};
+} // namespace structural
+
+#endif // STRUCTURAL_ATOMIC_NAMED_BITSET_HPP
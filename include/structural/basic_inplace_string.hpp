@@ -25,15 +25,51 @@
 #ifndef STRUCTURAL_BASIC_INPLACE_STRING_HPP
 #define STRUCTURAL_BASIC_INPLACE_STRING_HPP
 
+#include "structural/detail/find_kernels.hpp"
+#include "structural/detail/inplace_string_storage.hpp"
 #include "structural/detail/string_view_like.hpp"
-#include "structural/inplace_vector.hpp"
-
+#include "structural/detail/word_compare.hpp"
+
+#include <ctrx/contracts.hpp>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
 #include <string_view>
+#include <type_traits>
 
 #include <cstddef>
 
 namespace structural
 {
+/// Character traits that make basic_inplace_string keep all characters behind its last one zero
+///
+/// Equality and ordering of such strings with byte-sized characters and `std::char_traits` as `Base` compare their
+/// whole storage word by word, without depending on their sizes. In return, every operation that shrinks a string
+/// zeroes the characters it frees.
+///
+/// # Notes
+/// Characters compare like they do with `Base`.
+template<typename CharT, typename Base = std::char_traits<CharT>>
+struct zero_padded_traits : Base
+{
+    using base_traits = Base;
+};
+
+namespace detail
+{
+template<typename Traits>
+inline constexpr bool is_zero_padded = false;
+
+template<typename CharT, typename Base>
+inline constexpr bool is_zero_padded<zero_padded_traits<CharT, Base>> = true;
+} // namespace detail
+
 /// Stores and allows manipulation of contiguous character sequences.
 ///
 /// # Notes
@@ -42,17 +78,17 @@ template<typename CharT, std::size_t Capacity, typename Traits = std::char_trait
 struct basic_inplace_string
 {
     using traits_type            = Traits;
-    using value_type             = inplace_vector<CharT, Capacity>::value_type;
-    using size_type              = inplace_vector<CharT, Capacity>::size_type;
-    using difference_type        = inplace_vector<CharT, Capacity>::difference_type;
-    using reference              = inplace_vector<CharT, Capacity>::reference;
-    using const_reference        = inplace_vector<CharT, Capacity>::const_reference;
-    using pointer                = inplace_vector<CharT, Capacity>::pointer;
-    using const_pointer          = inplace_vector<CharT, Capacity>::const_pointer;
-    using iterator               = inplace_vector<CharT, Capacity>::iterator;
-    using const_iterator         = inplace_vector<CharT, Capacity>::const_iterator;
-    using reverse_iterator       = inplace_vector<CharT, Capacity>::reverse_iterator;
-    using const_reverse_iterator = inplace_vector<CharT, Capacity>::const_reverse_iterator;
+    using value_type             = std::array<CharT, Capacity + 1>::value_type;
+    using size_type              = std::array<CharT, Capacity + 1>::size_type;
+    using difference_type        = std::array<CharT, Capacity + 1>::difference_type;
+    using reference              = std::array<CharT, Capacity + 1>::reference;
+    using const_reference        = std::array<CharT, Capacity + 1>::const_reference;
+    using pointer                = std::array<CharT, Capacity + 1>::pointer;
+    using const_pointer          = std::array<CharT, Capacity + 1>::const_pointer;
+    using iterator               = std::array<CharT, Capacity + 1>::iterator;
+    using const_iterator         = std::array<CharT, Capacity + 1>::const_iterator;
+    using reverse_iterator       = std::array<CharT, Capacity + 1>::reverse_iterator;
+    using const_reverse_iterator = std::array<CharT, Capacity + 1>::const_reverse_iterator;
 
     /// Constructs an empty string
     constexpr basic_inplace_string() = default;
@@ -81,11 +117,7 @@ struct basic_inplace_string
     ///
     /// # Notes
     /// Independent of whether `s` contains null characters, the resulting string has length `count`.
-    constexpr basic_inplace_string(CharT const* s, size_type count)
-        : storage(s, s + count)
-    {
-        storage.push_back(CharT('\0'));
-    }
+    constexpr basic_inplace_string(CharT const* s, size_type count) { append_to_tail(s, count); }
 
     /// Constructs a string from the passed pointer
     ///
@@ -102,9 +134,8 @@ struct basic_inplace_string
     /// The distance between `begin` and `end` must not be greater than `Capacity`.
     template<std::input_iterator Iter, std::sentinel_for<Iter> Sentinel>
     constexpr basic_inplace_string(Iter begin, Sentinel end)
-        : storage(begin, end)
     {
-        storage.push_back(CharT('\0'));
+        append(begin, end);
     }
 
     /// Constructs a string from an initializer list
@@ -121,14 +152,9 @@ struct basic_inplace_string
     /// # Requires
     /// The argument's length must not be greater than `Capacity`.
     constexpr basic_inplace_string(detail::string_view_like<CharT, Traits> auto const& t)
-        : storage(
-            [&]
-            {
-                std::basic_string_view<CharT, Traits> sv = t;
-                return inplace_vector<CharT, Capacity + 1>(sv.begin(), sv.end());
-            }())
     {
-        storage.push_back(CharT('\0'));
+        std::basic_string_view<CharT, Traits> sv = t;
+        append_to_tail(sv.data(), sv.size());
     }
 
     constexpr basic_inplace_string(std::nullptr_t) = delete;
@@ -187,8 +213,7 @@ struct basic_inplace_string
         requires(C <= Capacity)
     constexpr auto assign(basic_inplace_string<CharT, C, Traits> const& str) -> basic_inplace_string&
     {
-        storage.assign(str.storage.begin(), str.storage.end());
-        return *this;
+        return assign(str.begin(), str.end());
     }
 
     /// Replaces the content of this string with the content of another string of lesser or equal capacity
@@ -196,11 +221,7 @@ struct basic_inplace_string
         requires(C <= Capacity)
     constexpr auto assign(basic_inplace_string<CharT, C, Traits>&& str) noexcept -> basic_inplace_string&
     {
-        if constexpr (C == Capacity)
-            storage = std::move(str.storage);
-        else
-            storage.assign(str.storage.begin(), str.storage.end());
-        return *this;
+        return assign(str.begin(), str.end());
     }
 
     /// Replaces the content of this string with the content of a legacy pointer and size pair
@@ -229,9 +250,21 @@ struct basic_inplace_string
     template<std::input_iterator Iter, std::sentinel_for<Iter> Sentinel>
     constexpr auto assign(Iter first, Sentinel last) -> basic_inplace_string&
     {
-        storage.assign(first, last);
-        storage.push_back(CharT('\0'));
-        return *this;
+        if constexpr (std::contiguous_iterator<Iter> && std::sized_sentinel_for<Sentinel, Iter>
+                      && std::same_as<std::iter_value_t<Iter>, CharT>)
+        {
+            // Traits::move, since the source may be (a part of) this string
+            auto const count = static_cast<size_type>(last - first);
+            CTRX_PRECONDITION(count <= Capacity);
+            Traits::move(data(), std::to_address(first), count);
+            set_size(count);
+            return *this;
+        }
+        else
+        {
+            clear();
+            return append(first, last);
+        }
     }
 
     /// Replaces the content of this string with the characters from an initializer list
@@ -261,7 +294,7 @@ struct basic_inplace_string
     {
         if (pos >= size())
             throw std::out_of_range{"basic_inplace_string::at"};
-        return storage.at(pos);
+        return data()[pos];
     }
 
     /// Returns a reference to the character at the specified position
@@ -272,32 +305,32 @@ struct basic_inplace_string
     {
         if (pos >= size())
             throw std::out_of_range{"basic_inplace_string::at"};
-        return storage.at(pos);
+        return data()[pos];
     }
 
     /// Returns a reference to the character at the specified position
     ///
     /// # Requires
     /// size() > `pos`
-    constexpr auto operator[](size_type pos) -> reference { return storage[pos]; }
+    constexpr auto operator[](size_type pos) -> reference { return data()[pos]; }
 
     /// Returns a reference to the character at the specified position
     ///
     /// # Requires
     /// size() > `pos`
-    constexpr auto operator[](size_type pos) const -> const_reference { return storage[pos]; }
+    constexpr auto operator[](size_type pos) const -> const_reference { return data()[pos]; }
 
     /// Returns a reference to the first character in the string
     ///
     /// # Requires
     /// size() > 0
-    constexpr auto front() -> reference { return storage.front(); }
+    constexpr auto front() -> reference { return data()[0]; }
 
     /// Returns a reference to the first character in the string
     ///
     /// # Requires
     /// size() > 0
-    constexpr auto front() const -> const_reference { return storage.front(); }
+    constexpr auto front() const -> const_reference { return data()[0]; }
 
     /// Returns a reference to the last character in the string
     ///
@@ -318,7 +351,7 @@ struct basic_inplace_string
     ///
     /// # Notes
     /// If the string is empty, the returned pointer points to a single null terminator.
-    constexpr auto data() const noexcept -> CharT const* { return storage.array.data(); }
+    constexpr auto data() const noexcept -> CharT const* { return storage.chars.data(); }
 
     /// Returns a pointer to the underlying array
     ///
@@ -327,7 +360,7 @@ struct basic_inplace_string
     ///
     /// # Notes
     /// If the string is empty, the returned pointer points to a single null terminator.
-    constexpr auto data() noexcept -> pointer { return storage.array.data(); }
+    constexpr auto data() noexcept -> pointer { return storage.chars.data(); }
 
     /// Returns a pointer to the underlying array
     ///
@@ -342,38 +375,38 @@ struct basic_inplace_string
     }
 
     /// Returns an iterator to the first character of the string
-    constexpr auto begin() noexcept -> iterator { return storage.begin(); }
+    constexpr auto begin() noexcept -> iterator { return storage.chars.begin(); }
     /// Returns an iterator to the first character of the string
-    constexpr auto begin() const noexcept -> const_iterator { return storage.begin(); }
+    constexpr auto begin() const noexcept -> const_iterator { return storage.chars.begin(); }
     /// Returns an iterator to the first character of the string
-    constexpr auto cbegin() const noexcept -> const_iterator { return storage.cbegin(); }
+    constexpr auto cbegin() const noexcept -> const_iterator { return begin(); }
 
     /// Returns a reverse iterator to the first character of the reversed string
-    constexpr auto rbegin() noexcept -> reverse_iterator { return storage.rbegin() + 1; }
+    constexpr auto rbegin() noexcept -> reverse_iterator { return reverse_iterator(end()); }
     /// Returns a reverse iterator to the first character of the reversed string
-    constexpr auto rbegin() const noexcept -> const_reverse_iterator { return storage.rbegin() + 1; }
+    constexpr auto rbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator(end()); }
     /// Returns a reverse iterator to the first character of the reversed string
-    constexpr auto crbegin() const noexcept -> const_reverse_iterator { return storage.crbegin() + 1; }
+    constexpr auto crbegin() const noexcept -> const_reverse_iterator { return rbegin(); }
 
     /// Returns an iterator past the last character of the string
-    constexpr auto end() noexcept -> iterator { return storage.end() - 1; }
+    constexpr auto end() noexcept -> iterator { return begin() + size(); }
     /// Returns an iterator past the last character of the string
-    constexpr auto end() const noexcept -> const_iterator { return storage.end() - 1; }
+    constexpr auto end() const noexcept -> const_iterator { return begin() + size(); }
     /// Returns an iterator past the last character of the string
-    constexpr auto cend() const noexcept -> const_iterator { return storage.cend() - 1; }
+    constexpr auto cend() const noexcept -> const_iterator { return end(); }
 
     /// Returns a reverse iterator past the last character of the reversed string
-    constexpr auto rend() noexcept -> reverse_iterator { return storage.rend(); }
+    constexpr auto rend() noexcept -> reverse_iterator { return reverse_iterator(begin()); }
     /// Returns a reverse iterator past the last character of the reversed string
-    constexpr auto rend() const noexcept -> const_reverse_iterator { return storage.rend(); }
+    constexpr auto rend() const noexcept -> const_reverse_iterator { return const_reverse_iterator(begin()); }
     /// Returns a reverse iterator past the last character of the reversed string
-    constexpr auto crend() const noexcept -> const_reverse_iterator { return storage.crend(); }
+    constexpr auto crend() const noexcept -> const_reverse_iterator { return rend(); }
 
     /// Checks whether the string has no content
     [[nodiscard]] constexpr auto empty() const noexcept -> bool { return size() == 0; }
 
     /// Returns the size of the string
-    constexpr auto size() const noexcept -> size_type { return storage.size() - 1; }
+    constexpr auto size() const noexcept -> size_type { return storage.size(); }
     /// Returns the size of the string
     constexpr auto length() const noexcept -> size_type { return size(); }
 
@@ -384,11 +417,7 @@ struct basic_inplace_string
     ///
     /// # Notes
     /// All pointers, references and iterators to elements of this string are invalidated.
-    constexpr void clear() noexcept
-    {
-        storage.clear();
-        storage.push_back(CharT('\0'));
-    }
+    constexpr void clear() noexcept { set_size(0); }
 
     /// Inserts a character at the specified position
     ///
@@ -401,7 +430,10 @@ struct basic_inplace_string
     /// # Notes
     /// Doesn't invalidate any iterators, references or pointers into the string, but they may point to different
     /// characters after insertion.
-    constexpr auto insert(const_iterator pos, CharT ch) -> iterator { return storage.insert(pos, ch); }
+    constexpr auto insert(const_iterator pos, CharT ch) -> iterator
+    {
+        return insert_disjoint(static_cast<size_type>(pos - cbegin()), &ch, 1);
+    }
 
     /// Inserts a null terminated string at the specified position
     ///
@@ -484,7 +516,25 @@ struct basic_inplace_string
     template<std::input_iterator Iter, std::sentinel_for<Iter> Sentinel>
     constexpr auto insert(const_iterator pos, Iter first, Sentinel last) -> iterator
     {
-        return storage.insert(pos, first, last);
+        auto const idx = static_cast<size_type>(pos - cbegin());
+        if constexpr (std::contiguous_iterator<Iter> && std::sized_sentinel_for<Sentinel, Iter>
+                      && std::same_as<std::iter_value_t<Iter>, CharT>)
+        {
+            auto const count = static_cast<size_type>(last - first);
+            if (std::is_constant_evaluated() || overlaps(std::to_address(first)))
+            {
+                basic_inplace_string const copy(first, last);
+                return insert_disjoint(idx, copy.data(), count);
+            }
+            return insert_disjoint(idx, std::to_address(first), count);
+        }
+        else
+        {
+            auto const old_size = size();
+            append(first, last);
+            std::rotate(begin() + idx, begin() + old_size, end());
+            return begin() + idx;
+        }
     }
 
     /// Inserts the characters from an initializer_list at the specified position
@@ -512,7 +562,7 @@ struct basic_inplace_string
     /// Invalidates any iterators, references or pointers to the last character of the string. Iterators, references or
     /// pointers to characters between `position` and the last character may point to different characters after
     /// erasure.
-    constexpr auto erase(const_iterator position) -> iterator { return storage.erase(position); }
+    constexpr auto erase(const_iterator position) -> iterator { return erase(position, position + 1); }
 
     /// Removes all character in the specified range from the string
     ///
@@ -523,7 +573,15 @@ struct basic_inplace_string
     /// Invalidates any iterators, references or pointers to the last n characters of the string, where n is the
     /// distance between `first` and `last`. Iterators, references or pointers to characters between `first` and the
     /// size()-n character may point to different characters after erasure.
-    constexpr auto erase(const_iterator first, const_iterator last) -> iterator { return storage.erase(first, last); }
+    constexpr auto erase(const_iterator first, const_iterator last) -> iterator
+    {
+        auto const idx      = static_cast<size_type>(first - cbegin());
+        auto const count    = static_cast<size_type>(last - first);
+        auto const old_size = size();
+        Traits::move(data() + idx, data() + idx + count, old_size - idx - count);
+        set_size(old_size - count);
+        return begin() + idx;
+    }
 
     /// Appends the given character to the end of the string
     ///
@@ -534,8 +592,10 @@ struct basic_inplace_string
     /// Doesn't invalidate any iterators, references or pointers into this string.
     constexpr void push_back(CharT ch)
     {
-        storage.back() = ch;
-        storage.push_back(CharT('\0'));
+        auto const old_size = size();
+        CTRX_PRECONDITION(old_size < Capacity);
+        data()[old_size] = ch;
+        set_size(old_size + 1);
     }
 
     /// Removes the last character from the end of the string
@@ -547,8 +607,34 @@ struct basic_inplace_string
     /// Invalidate any iterators, references or pointers to the last character of this string.
     constexpr void pop_back()
     {
-        storage.pop_back();
-        storage.back() = CharT('\0');
+        CTRX_PRECONDITION(!empty());
+        set_size(size() - 1);
+    }
+
+    /// Lets `op` write the contents of the string in place
+    ///
+    /// `op` is called as `op(data(), count)` and returns the new size of the string. It may modify the characters in
+    /// [data(), data() + count); those beyond the old size() have unspecified values when it is called.
+    ///
+    /// # Requires
+    /// - `count` must not be greater than `Capacity`.
+    /// - `op` must return a value no greater than `count`.
+    ///
+    /// # Notes
+    /// Doesn't invalidate any iterators, references or pointers into this string.
+    template<typename Operation>
+    constexpr void resize_and_overwrite(size_type count, Operation op)
+    {
+        CTRX_PRECONDITION(count <= Capacity);
+        auto const new_size = static_cast<size_type>(std::move(op)(data(), count));
+        CTRX_PRECONDITION(new_size <= count);
+        if constexpr (detail::is_zero_padded<Traits>)
+        {
+            // op may have written behind new_size
+            if (auto const written = std::max(count, size()); new_size < written)
+                Traits::assign(data() + new_size, written - new_size, CharT());
+        }
+        storage.set_size(new_size);
     }
 
     /// Appends the given string to the end of the string
@@ -560,8 +646,7 @@ struct basic_inplace_string
     /// Doesn't invalidate any iterators, references or pointers into this string.
     constexpr auto append(basic_inplace_string const& str) -> basic_inplace_string&
     {
-        storage.insert(end(), str.begin(), str.end());
-        return *this;
+        return append_to_tail(str.data(), str.size());
     }
 
     /// Appends the given character to the end of the string
@@ -573,7 +658,7 @@ struct basic_inplace_string
     /// Doesn't invalidate any iterators, references or pointers into this string.
     constexpr auto append(CharT ch) -> basic_inplace_string&
     {
-        storage.insert(end(), ch);
+        push_back(ch);
         return *this;
     }
 
@@ -616,8 +701,15 @@ struct basic_inplace_string
     template<std::input_iterator Iter, std::sentinel_for<Iter> Sentinel>
     constexpr auto append(Iter first, Sentinel last) -> basic_inplace_string&
     {
-        storage.insert(end(), first, last);
-        return *this;
+        if constexpr (std::contiguous_iterator<Iter> && std::sized_sentinel_for<Sentinel, Iter>
+                      && std::same_as<std::iter_value_t<Iter>, CharT>)
+            return append_to_tail(std::to_address(first), static_cast<size_type>(last - first));
+        else
+        {
+            for (; first != last; ++first)
+                push_back(*first);
+            return *this;
+        }
     }
 
     /// Appends the characters from the given initializer list to the end of the string
@@ -629,8 +721,7 @@ struct basic_inplace_string
     /// Doesn't invalidate any iterators, references or pointers into this string.
     constexpr auto append(std::initializer_list<CharT> ilist) -> basic_inplace_string&
     {
-        storage.insert(end(), ilist);
-        return *this;
+        return append_to_tail(ilist.begin(), ilist.size());
     }
 
     /// Appends the characters from the given string_view-like type to the end of the string
@@ -643,7 +734,7 @@ struct basic_inplace_string
     constexpr auto append(detail::string_view_like<CharT, Traits> auto const& t) -> basic_inplace_string&
     {
         std::basic_string_view<CharT, Traits> sv = t;
-        return append(sv.begin(), sv.end());
+        return append_to_tail(sv.data(), sv.size());
     }
 
     /// Equivalent to append(str)
@@ -671,6 +762,11 @@ struct basic_inplace_string
     /// compare equivalent; a positive value, if `*this` is ordered after `str`.
     constexpr auto compare(basic_inplace_string const& str) const noexcept -> int
     {
+        if constexpr (s_word_compare)
+        {
+            if (!std::is_constant_evaluated())
+                return compare_words(str);
+        }
         std::basic_string_view<CharT, Traits> const sv = str;
         return compare(sv);
     }
@@ -821,6 +917,250 @@ struct basic_inplace_string
         return replace(first, last, sv.begin(), sv.end());
     }
 
+    /// Finds the first occurrence of the substring `sv`, starting at `pos`
+    ///
+    /// # Return value
+    /// The position of the first character of the found substring, or npos if there is none.
+    constexpr auto find(std::basic_string_view<CharT, Traits> sv, size_type pos = 0) const noexcept -> size_type
+    {
+        if constexpr (s_vectorized_search)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                auto const kernel = [&](char const* p, size_type n, size_type readable)
+                { return detail::find_kernels::find(p, n, readable, as_chars(sv)); };
+                return search_forward(pos, kernel);
+            }
+        }
+        return std::basic_string_view<CharT, Traits>(*this).find(sv, pos);
+    }
+
+    /// Equivalent to find(std::basic_string_view(&ch, 1), pos)
+    constexpr auto find(CharT ch, size_type pos = 0) const noexcept -> size_type
+    {
+        if constexpr (s_vectorized_search)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                auto const kernel = [&](char const* p, size_type n, size_type readable)
+                { return detail::find_kernels::find_byte(p, n, readable, static_cast<char>(ch)); };
+                return search_forward(pos, kernel);
+            }
+        }
+        return std::basic_string_view<CharT, Traits>(*this).find(ch, pos);
+    }
+
+    /// Equivalent to find(std::basic_string_view(s, count), pos)
+    constexpr auto find(CharT const* s, size_type pos, size_type count) const -> size_type
+    {
+        return find(std::basic_string_view<CharT, Traits>(s, count), pos);
+    }
+
+    /// Equivalent to find(std::basic_string_view(s), pos)
+    constexpr auto find(CharT const* s, size_type pos = 0) const -> size_type
+    {
+        return find(std::basic_string_view<CharT, Traits>(s), pos);
+    }
+
+    /// Finds the last occurrence of the substring `sv` that starts at or before `pos`
+    ///
+    /// # Return value
+    /// The position of the first character of the found substring, or npos if there is none.
+    constexpr auto rfind(std::basic_string_view<CharT, Traits> sv, size_type pos = npos) const noexcept -> size_type
+    {
+        return std::basic_string_view<CharT, Traits>(*this).rfind(sv, pos);
+    }
+
+    /// Equivalent to rfind(std::basic_string_view(&ch, 1), pos)
+    constexpr auto rfind(CharT ch, size_type pos = npos) const noexcept -> size_type
+    {
+        if constexpr (s_vectorized_search)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                auto const kernel = [&](char const* p, size_type n, size_type readable)
+                { return detail::find_kernels::rfind_byte(p, n, readable, static_cast<char>(ch)); };
+                return search_backward(pos, kernel);
+            }
+        }
+        return std::basic_string_view<CharT, Traits>(*this).rfind(ch, pos);
+    }
+
+    /// Equivalent to rfind(std::basic_string_view(s, count), pos)
+    constexpr auto rfind(CharT const* s, size_type pos, size_type count) const -> size_type
+    {
+        return rfind(std::basic_string_view<CharT, Traits>(s, count), pos);
+    }
+
+    /// Equivalent to rfind(std::basic_string_view(s), pos)
+    constexpr auto rfind(CharT const* s, size_type pos = npos) const -> size_type
+    {
+        return rfind(std::basic_string_view<CharT, Traits>(s), pos);
+    }
+
+    /// Finds the first character equal to any of the characters in `sv`, starting at `pos`
+    ///
+    /// # Return value
+    /// The position of the found character, or npos if there is none.
+    constexpr auto find_first_of(std::basic_string_view<CharT, Traits> sv, size_type pos = 0) const noexcept
+        -> size_type
+    {
+        if constexpr (s_vectorized_search)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                auto const kernel = [&](char const* p, size_type n, size_type readable)
+                { return detail::find_kernels::find_of<false>(p, n, readable, as_chars(sv), false); };
+                return search_forward(pos, kernel);
+            }
+        }
+        return std::basic_string_view<CharT, Traits>(*this).find_first_of(sv, pos);
+    }
+
+    /// Equivalent to find_first_of(std::basic_string_view(&ch, 1), pos)
+    constexpr auto find_first_of(CharT ch, size_type pos = 0) const noexcept -> size_type
+    {
+        return find_first_of(std::basic_string_view<CharT, Traits>(&ch, 1), pos);
+    }
+
+    /// Equivalent to find_first_of(std::basic_string_view(s, count), pos)
+    constexpr auto find_first_of(CharT const* s, size_type pos, size_type count) const -> size_type
+    {
+        return find_first_of(std::basic_string_view<CharT, Traits>(s, count), pos);
+    }
+
+    /// Equivalent to find_first_of(std::basic_string_view(s), pos)
+    constexpr auto find_first_of(CharT const* s, size_type pos = 0) const -> size_type
+    {
+        return find_first_of(std::basic_string_view<CharT, Traits>(s), pos);
+    }
+
+    /// Finds the first character not equal to any of the characters in `sv`, starting at `pos`
+    ///
+    /// # Return value
+    /// The position of the found character, or npos if there is none.
+    constexpr auto find_first_not_of(std::basic_string_view<CharT, Traits> sv, size_type pos = 0) const noexcept
+        -> size_type
+    {
+        if constexpr (s_vectorized_search)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                auto const kernel = [&](char const* p, size_type n, size_type readable)
+                { return detail::find_kernels::find_of<false>(p, n, readable, as_chars(sv), true); };
+                return search_forward(pos, kernel);
+            }
+        }
+        return std::basic_string_view<CharT, Traits>(*this).find_first_not_of(sv, pos);
+    }
+
+    /// Equivalent to find_first_not_of(std::basic_string_view(&ch, 1), pos)
+    constexpr auto find_first_not_of(CharT ch, size_type pos = 0) const noexcept -> size_type
+    {
+        return find_first_not_of(std::basic_string_view<CharT, Traits>(&ch, 1), pos);
+    }
+
+    /// Equivalent to find_first_not_of(std::basic_string_view(s, count), pos)
+    constexpr auto find_first_not_of(CharT const* s, size_type pos, size_type count) const -> size_type
+    {
+        return find_first_not_of(std::basic_string_view<CharT, Traits>(s, count), pos);
+    }
+
+    /// Equivalent to find_first_not_of(std::basic_string_view(s), pos)
+    constexpr auto find_first_not_of(CharT const* s, size_type pos = 0) const -> size_type
+    {
+        return find_first_not_of(std::basic_string_view<CharT, Traits>(s), pos);
+    }
+
+    /// Finds the last character equal to any of the characters in `sv`, at or before `pos`
+    ///
+    /// # Return value
+    /// The position of the found character, or npos if there is none.
+    constexpr auto find_last_of(std::basic_string_view<CharT, Traits> sv, size_type pos = npos) const noexcept
+        -> size_type
+    {
+        if constexpr (s_vectorized_search)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                auto const kernel = [&](char const* p, size_type n, size_type readable)
+                { return detail::find_kernels::find_of<true>(p, n, readable, as_chars(sv), false); };
+                return search_backward(pos, kernel);
+            }
+        }
+        return std::basic_string_view<CharT, Traits>(*this).find_last_of(sv, pos);
+    }
+
+    /// Equivalent to find_last_of(std::basic_string_view(&ch, 1), pos)
+    constexpr auto find_last_of(CharT ch, size_type pos = npos) const noexcept -> size_type
+    {
+        return find_last_of(std::basic_string_view<CharT, Traits>(&ch, 1), pos);
+    }
+
+    /// Equivalent to find_last_of(std::basic_string_view(s, count), pos)
+    constexpr auto find_last_of(CharT const* s, size_type pos, size_type count) const -> size_type
+    {
+        return find_last_of(std::basic_string_view<CharT, Traits>(s, count), pos);
+    }
+
+    /// Equivalent to find_last_of(std::basic_string_view(s), pos)
+    constexpr auto find_last_of(CharT const* s, size_type pos = npos) const -> size_type
+    {
+        return find_last_of(std::basic_string_view<CharT, Traits>(s), pos);
+    }
+
+    /// Finds the last character not equal to any of the characters in `sv`, at or before `pos`
+    ///
+    /// # Return value
+    /// The position of the found character, or npos if there is none.
+    constexpr auto find_last_not_of(std::basic_string_view<CharT, Traits> sv, size_type pos = npos) const noexcept
+        -> size_type
+    {
+        if constexpr (s_vectorized_search)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                auto const kernel = [&](char const* p, size_type n, size_type readable)
+                { return detail::find_kernels::find_of<true>(p, n, readable, as_chars(sv), true); };
+                return search_backward(pos, kernel);
+            }
+        }
+        return std::basic_string_view<CharT, Traits>(*this).find_last_not_of(sv, pos);
+    }
+
+    /// Equivalent to find_last_not_of(std::basic_string_view(&ch, 1), pos)
+    constexpr auto find_last_not_of(CharT ch, size_type pos = npos) const noexcept -> size_type
+    {
+        return find_last_not_of(std::basic_string_view<CharT, Traits>(&ch, 1), pos);
+    }
+
+    /// Equivalent to find_last_not_of(std::basic_string_view(s, count), pos)
+    constexpr auto find_last_not_of(CharT const* s, size_type pos, size_type count) const -> size_type
+    {
+        return find_last_not_of(std::basic_string_view<CharT, Traits>(s, count), pos);
+    }
+
+    /// Equivalent to find_last_not_of(std::basic_string_view(s), pos)
+    constexpr auto find_last_not_of(CharT const* s, size_type pos = npos) const -> size_type
+    {
+        return find_last_not_of(std::basic_string_view<CharT, Traits>(s), pos);
+    }
+
+    /// Checks if this string contains the substring `sv`
+    constexpr auto contains(std::basic_string_view<CharT, Traits> sv) const noexcept -> bool
+    {
+        return find(sv) != npos;
+    }
+
+    /// Checks if this string contains the character `ch`
+    constexpr auto contains(CharT ch) const noexcept -> bool { return find(ch) != npos; }
+
+    /// Checks if this string contains the null terminated string `s`
+    ///
+    /// # Requires
+    /// `s` must be a valid pointer to a null terminated character array.
+    constexpr auto contains(CharT const* s) const -> bool { return find(s) != npos; }
+
     /// Returns a view to a substring
     ///
     /// # Return value
@@ -840,7 +1180,94 @@ struct basic_inplace_string
 
     // -- internal API
 
-    inplace_vector<CharT, Capacity + 1> storage{CharT{'\0'}};
+    // Whether the search functions may use the run-time kernels, which compare raw bytes
+    static constexpr bool s_vectorized_search = sizeof(CharT) == 1 && std::same_as<Traits, std::char_traits<CharT>>;
+
+    static auto as_chars(std::basic_string_view<CharT, Traits> sv) noexcept -> std::string_view
+    {
+        return {reinterpret_cast<char const*>(sv.data()), sv.size()};
+    }
+
+    // Runs kernel on [pos, size()). The kernel may read up to the end of the storage.
+    template<typename Kernel>
+    auto search_forward(size_type pos, Kernel kernel) const noexcept -> size_type
+    {
+        if (pos > size())
+            return npos;
+        auto const r = kernel(reinterpret_cast<char const*>(data()) + pos, size() - pos, Capacity + 1 - pos);
+        return r == npos ? npos : r + pos;
+    }
+
+    // Runs kernel on [0, min(pos + 1, size())). The kernel may read up to the end of the storage.
+    template<typename Kernel>
+    auto search_backward(size_type pos, Kernel kernel) const noexcept -> size_type
+    {
+        if (empty())
+            return npos;
+        return kernel(reinterpret_cast<char const*>(data()), std::min(pos, size() - 1) + 1, Capacity + 1);
+    }
+
+    // Whether equality and ordering with another string of the same type may compare the zero-padded storage as words
+    static constexpr bool s_word_compare = sizeof(CharT) == 1 && std::same_as<Traits, zero_padded_traits<CharT>>;
+
+    // Sets the size and writes the terminator. With zero_padded_traits, also zeroes the characters freed by shrinking.
+    constexpr void set_size(size_type n) noexcept
+    {
+        if constexpr (detail::is_zero_padded<Traits>)
+        {
+            if (auto const old_size = size(); n < old_size)
+                Traits::assign(data() + n, old_size - n, CharT());
+        }
+        storage.set_size(n);
+    }
+
+    // Word-wise equality for s_word_compare. Small strings store their size in the last character, which therefore
+    // takes part in the comparison.
+    auto equal_words(basic_inplace_string const& other) const noexcept -> bool
+    {
+        if constexpr (detail::compact_inplace_string_storage<Capacity>)
+            return detail::word_compare::equal<Capacity + 1>(data(), other.data());
+        else
+            return detail::word_compare::equal<Capacity>(data(), other.data()) & (size() == other.size());
+    }
+
+    // Word-wise three-way comparison for s_word_compare. The zero padding makes a string compare equal to its
+    // extension by null characters, so the sizes break ties.
+    auto compare_words(basic_inplace_string const& other) const noexcept -> int
+    {
+        int const cmp = detail::word_compare::compare<Capacity>(data(), other.data());
+        return cmp != 0 ? cmp : (size() > other.size()) - (size() < other.size());
+    }
+
+    // Copies the characters directly behind the last one and moves the terminator, instead of inserting in front of it.
+    // s may point into this string, as the source then ends at or before the terminator.
+    constexpr auto append_to_tail(CharT const* s, size_type count) -> basic_inplace_string&
+    {
+        auto const old_size = size();
+        CTRX_PRECONDITION(count <= Capacity - old_size);
+        Traits::copy(data() + old_size, s, count);
+        set_size(old_size + count);
+        return *this;
+    }
+
+    // Inserts count characters at idx, which must not point into this string
+    constexpr auto insert_disjoint(size_type idx, CharT const* s, size_type count) -> iterator
+    {
+        auto const old_size = size();
+        CTRX_PRECONDITION(idx <= old_size && count <= Capacity - old_size);
+        Traits::move(data() + idx + count, data() + idx, old_size - idx);
+        Traits::copy(data() + idx, s, count);
+        set_size(old_size + count);
+        return begin() + idx;
+    }
+
+    // Whether p points into the storage of this string. Only usable at run time.
+    auto overlaps(CharT const* p) const noexcept -> bool
+    {
+        return !std::less<>{}(p, data()) && std::less<>{}(p, data() + Capacity + 1);
+    }
+
+    detail::inplace_string_storage<CharT, Capacity> storage{};
 };
 
 template<class CharT, std::size_t Capacity>
@@ -882,7 +1309,12 @@ template<class CharT, std::size_t Capacity, class Traits>
 constexpr auto operator==(basic_inplace_string<CharT, Capacity, Traits> const& lhs,
                           basic_inplace_string<CharT, Capacity, Traits> const& rhs) noexcept -> bool
 {
-    return std::ranges::equal(lhs, rhs);
+    if constexpr (basic_inplace_string<CharT, Capacity, Traits>::s_word_compare)
+    {
+        if (!std::is_constant_evaluated())
+            return lhs.equal_words(rhs);
+    }
+    return std::basic_string_view<CharT, Traits>(lhs) == std::basic_string_view<CharT, Traits>(rhs);
 }
 
 /// Compares two strings for equality
@@ -892,7 +1324,7 @@ constexpr auto operator==(basic_inplace_string<CharT, Capacity, Traits> const& l
 template<class CharT, std::size_t Capacity, class Traits>
 constexpr auto operator==(basic_inplace_string<CharT, Capacity, Traits> const& lhs, CharT const* rhs) -> bool
 {
-    return std::ranges::equal(lhs, std::basic_string_view(rhs));
+    return std::basic_string_view<CharT, Traits>(lhs) == std::basic_string_view<CharT, Traits>(rhs);
 }
 
 /// Compares two strings for equality
@@ -900,7 +1332,7 @@ template<class CharT, std::size_t Capacity, class Traits>
 constexpr auto operator==(basic_inplace_string<CharT, Capacity, Traits> const& lhs,
                           detail::string_view_like<CharT, Traits> auto const& rhs) -> bool
 {
-    return std::ranges::equal(lhs, rhs);
+    return std::basic_string_view<CharT, Traits>(lhs) == std::basic_string_view<CharT, Traits>(rhs);
 }
 
 /// Three-way compares two strings lexicographically
@@ -908,7 +1340,12 @@ template<class CharT, std::size_t Capacity, class Traits>
 constexpr auto operator<=>(basic_inplace_string<CharT, Capacity, Traits> const& lhs,
                            basic_inplace_string<CharT, Capacity, Traits> const& rhs) noexcept
 {
-    return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    if constexpr (basic_inplace_string<CharT, Capacity, Traits>::s_word_compare)
+    {
+        if (!std::is_constant_evaluated())
+            return lhs.compare_words(rhs) <=> 0;
+    }
+    return std::basic_string_view<CharT, Traits>(lhs) <=> std::basic_string_view<CharT, Traits>(rhs);
 }
 
 /// Three-way compares two strings lexicographically
@@ -926,8 +1363,7 @@ template<class CharT, std::size_t Capacity, class Traits>
 constexpr auto operator<=>(basic_inplace_string<CharT, Capacity, Traits> const& lhs,
                            detail::string_view_like<CharT, Traits> auto const& rhs) noexcept
 {
-    std::basic_string_view<CharT, Traits> sv = rhs;
-    return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), sv.begin(), sv.end());
+    return std::basic_string_view<CharT, Traits>(lhs) <=> std::basic_string_view<CharT, Traits>(rhs);
 }
 
 /// Erases all elements in `c` that compare equal to `value`
@@ -968,7 +1404,10 @@ struct hash<structural::basic_inplace_string<CharT, Capacity, Traits>>
 {
     auto operator()(structural::basic_inplace_string<CharT, Capacity, Traits> const& str) const -> std::size_t
     {
-        return hash<std::basic_string_view<CharT, Traits>>{}(str);
+        if constexpr (structural::detail::is_zero_padded<Traits>)
+            return hash<std::basic_string_view<CharT, typename Traits::base_traits>>{}({str.data(), str.size()});
+        else
+            return hash<std::basic_string_view<CharT, Traits>>{}(str);
     }
 };
 } // namespace std
@@ -25,13 +25,23 @@
 #ifndef STRUCTURAL_BITSET_HPP
 #define STRUCTURAL_BITSET_HPP
 
+#include "structural/basic_inplace_string.hpp"
+#include "structural/detail/bitset_kernels.hpp"
+
 #include <ctrx/contracts.hpp>
 
 #include <algorithm>
 #include <array>
 #include <bit>
-#include <numeric>
+#include <concepts>
+#include <functional>
+#include <iterator>
 #include <ostream>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
 
 #include <climits>
 #include <cstddef>
@@ -39,64 +49,197 @@
 
 namespace structural
 {
+namespace detail
+{
+// Widest unsigned word needed to hold N bits; bitsets that don't fit into a single word use 64-bit chunks.
 template<std::size_t N>
+using default_bitset_chunk_t = std::conditional_t<
+    (N <= 8),
+    std::uint8_t,
+    std::conditional_t<(N <= 16), std::uint16_t, std::conditional_t<(N <= 32), std::uint32_t, std::uint64_t>>>;
+} // namespace detail
+
+template<std::size_t N, std::unsigned_integral Chunk = detail::default_bitset_chunk_t<N>>
 struct bitset;
 
 namespace detail
 {
-template<std::size_t N>
-constexpr std::size_t bits_per_chunk = sizeof(typename bitset<N>::chunk_t) * CHAR_BIT;
+template<std::unsigned_integral Chunk>
+constexpr std::size_t bits_per_chunk = sizeof(Chunk) * CHAR_BIT;
 
-template<std::size_t N>
-constexpr std::size_t chunk_size = 1 + ((N - 1) / bits_per_chunk<N>);
+template<std::size_t N, std::unsigned_integral Chunk>
+constexpr std::size_t chunk_size = 1 + ((N - 1) / bits_per_chunk<Chunk>);
 
-template<std::size_t N>
-constexpr auto chunk_index_for(bitset<N> const& bs, std::size_t pos) noexcept -> std::size_t
+// Mask of the bits of the most significant chunk that are part of the bitset
+template<std::size_t N, std::unsigned_integral Chunk>
+constexpr Chunk tail_mask = N % bits_per_chunk<Chunk> == 0 ? Chunk(~Chunk{0})
+                                                           : Chunk((Chunk{1} << (N % bits_per_chunk<Chunk>)) - 1u);
+
+template<std::size_t N, std::unsigned_integral Chunk>
+constexpr auto chunk_index_for(bitset<N, Chunk> const& bs, std::size_t pos) noexcept -> std::size_t
 {
     CTRX_PRECONDITION(pos < N);
     CTRX_PRECONDITION(N > 0);
-    return bs.chunks.size() - pos / bits_per_chunk<N> - 1;
+    return bs.chunks.size() - pos / bits_per_chunk<Chunk> - 1;
 }
 
-template<std::size_t N>
-constexpr auto chunk_for(bitset<N> const& bs, std::size_t pos) noexcept -> typename bitset<N>::chunk_t const&
+template<std::size_t N, std::unsigned_integral Chunk>
+constexpr auto chunk_for(bitset<N, Chunk> const& bs, std::size_t pos) noexcept -> Chunk const&
 {
     return bs.chunks[chunk_index_for(bs, pos)];
 }
 
-template<std::size_t N>
-constexpr auto chunk_for(bitset<N>& bs, std::size_t pos) noexcept -> typename bitset<N>::chunk_t&
+template<std::size_t N, std::unsigned_integral Chunk>
+constexpr auto chunk_for(bitset<N, Chunk>& bs, std::size_t pos) noexcept -> Chunk&
 {
     return bs.chunks[chunk_index_for(bs, pos)];
 }
 
-template<std::size_t N, typename CharT, typename Traits = std::char_traits<CharT>>
-constexpr void
-set_from_str(bitset<N>& bs, std::basic_string_view<CharT, Traits> sv, CharT zero = CharT('0'), CharT one = CharT('1'))
+// The eight bits starting at pos, which may span two chunks
+template<std::size_t N, std::unsigned_integral Chunk>
+constexpr auto get_bits8(bitset<N, Chunk> const& bs, std::size_t pos) noexcept -> std::uint8_t
+{
+    CTRX_PRECONDITION(pos + 8 <= N);
+    auto const idx   = chunk_index_for(bs, pos);
+    auto const off   = pos % bits_per_chunk<Chunk>;
+    auto       value = std::uint64_t(bs.chunks[idx]) >> off;
+    if (off + 8 > bits_per_chunk<Chunk>)
+        value |= std::uint64_t(bs.chunks[idx - 1]) << (bits_per_chunk<Chunk> - off);
+    return static_cast<std::uint8_t>(value);
+}
+
+// Sets the bits set in value among the eight bits starting at pos, which may span two chunks
+template<std::size_t N, std::unsigned_integral Chunk>
+constexpr void or_bits8(bitset<N, Chunk>& bs, std::size_t pos, std::uint8_t value) noexcept
+{
+    CTRX_PRECONDITION(pos + 8 <= N);
+    auto const idx = chunk_index_for(bs, pos);
+    auto const off = pos % bits_per_chunk<Chunk>;
+    bs.chunks[idx] |= static_cast<Chunk>(std::uint64_t(value) << off);
+    if (off + 8 > bits_per_chunk<Chunk>)
+        bs.chunks[idx - 1] |= static_cast<Chunk>(value >> (bits_per_chunk<Chunk> - off));
+}
+
+// Sets the bits of an empty bitset from their textual representation, the first character being the most significant
+// bit. Strings of single-byte characters are parsed eight characters at a time.
+template<std::size_t N, std::unsigned_integral Chunk, typename CharT, typename Traits = std::char_traits<CharT>>
+constexpr void set_from_str(bitset<N, Chunk>&                     bs,
+                            std::basic_string_view<CharT, Traits> sv,
+                            CharT                                 zero = CharT('0'),
+                            CharT                                 one  = CharT('1'))
 {
-    for (unsigned i = sv.size(); i > 0u; --i)
+    CTRX_PRECONDITION(sv.size() <= N);
+    constexpr auto block_size = bitset_kernels::text_block_size;
+
+    std::size_t i = 0;
+    if constexpr (bitset_kernels::single_byte_char<CharT>)
     {
-        if (sv[i - 1] == one)
-            bs.set(N - i, true);
-        else if (sv[i - 1] == zero)
-            bs.set(N - i, false);
-        else
+        for (; i + block_size <= sv.size(); i += block_size)
+        {
+            std::uint8_t bits = 0;
+            if (!bitset_kernels::parse_text_block(sv.data() + i, zero, one, bits))
+                throw std::invalid_argument{"invalid character in bitset initializer string"};
+            or_bits8(bs, N - i - block_size, bits);
+        }
+    }
+    for (; i < sv.size(); ++i)
+    {
+        if (sv[i] == one)
+            bs.set(N - i - 1, true);
+        else if (sv[i] != zero)
             throw std::invalid_argument{"invalid character in bitset initializer string"};
     }
 }
+
+// Writes the N characters representing bs to out, the most significant bit first
+template<std::size_t N, std::unsigned_integral Chunk, typename CharT>
+constexpr void write_str(bitset<N, Chunk> const& bs, CharT* out, CharT zero, CharT one) noexcept
+{
+    constexpr auto block_size = bitset_kernels::text_block_size;
+
+    std::size_t i = 0;
+    if constexpr (bitset_kernels::single_byte_char<CharT>)
+    {
+        for (; i + block_size <= N; i += block_size)
+            bitset_kernels::format_text_block(out + i, get_bits8(bs, N - i - block_size), zero, one);
+    }
+    for (; i < N; ++i)
+        out[i] = bs.test(N - i - 1) ? one : zero;
+}
 } // namespace detail
 
-template<std::size_t N>
+/// Fixed-size sequence of N bits that is usable as a non-type template parameter.
+///
+/// The bits are stored in an array of Chunk words, most significant chunk first. Bits of the most significant chunk
+/// beyond N are always zero, which allows all bulk operations to work on whole words.
+///
+/// # Notes
+///  - Chunk defaults to the smallest unsigned word that holds all N bits, or to std::uint64_t for larger bitsets.
+template<std::size_t N, std::unsigned_integral Chunk>
 struct bitset
 {
-    using chunk_t = std::uint8_t;
+    using chunk_t = Chunk;
+
+    static constexpr std::size_t npos = -1;
+
+    /// Forward iterator over the indices of the set bits, in ascending order
+    class set_bit_iterator
+    {
+    public:
+        using value_type      = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        constexpr set_bit_iterator() noexcept = default;
+        constexpr set_bit_iterator(bitset const& bs, std::size_t word) noexcept
+            : bs(&bs)
+            , word(word)
+        {
+            if (word < chunks_size)
+                remaining = bs.word(word);
+            skip_empty_words();
+        }
+
+        constexpr auto operator==(set_bit_iterator const&) const noexcept -> bool = default;
+
+        [[nodiscard]] constexpr auto operator*() const noexcept -> std::size_t
+        {
+            return word * bits_per_chunk + std::countr_zero(remaining);
+        }
+
+        constexpr auto operator++() noexcept -> set_bit_iterator&
+        {
+            remaining &= remaining - 1u;
+            skip_empty_words();
+            return *this;
+        }
+
+        constexpr auto operator++(int) noexcept -> set_bit_iterator
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+    private:
+        constexpr void skip_empty_words() noexcept
+        {
+            while (remaining == 0 && word < chunks_size)
+                if (++word < chunks_size)
+                    remaining = bs->word(word);
+        }
+
+        bitset const* bs        = nullptr;
+        std::size_t   word      = 0;
+        chunk_t       remaining = 0;
+    };
 
     constexpr bitset() noexcept = default;
     constexpr explicit bitset(unsigned long long val) noexcept
     {
-        for (unsigned i = 0u; i < (sizeof(val) * CHAR_BIT); ++i)
-            if ((val >> i) & 1u)
-                set(i);
+        constexpr auto bits_per_chunk = detail::bits_per_chunk<chunk_t>;
+        for (std::size_t i = 0; i < chunks.size() && i * bits_per_chunk < sizeof(val) * CHAR_BIT; ++i)
+            chunks[chunks.size() - i - 1] = chunk_t(val >> (i * bits_per_chunk));
+        chunks.front() &= detail::tail_mask<N, chunk_t>;
     }
     template<typename CharT = char, typename Traits = std::char_traits<CharT>>
     constexpr explicit bitset(std::basic_string_view<CharT, Traits> sv, CharT zero = CharT('0'), CharT one = CharT('1'))
@@ -113,7 +256,7 @@ struct bitset
     [[nodiscard]] constexpr auto test(std::size_t pos) const noexcept -> bool
     {
         auto const chunk = detail::chunk_for(*this, pos);
-        auto const n     = pos % detail::bits_per_chunk<N>;
+        auto const n     = pos % detail::bits_per_chunk<chunk_t>;
         return (chunk >> n) & 1u;
     }
 
@@ -137,56 +280,119 @@ struct bitset
 
     [[nodiscard]] constexpr auto all() const noexcept -> bool
     {
-        for (std::size_t i = 0; i < N; ++i)
-            if (!test(i))
+        if (chunks.front() != detail::tail_mask<N, chunk_t>)
+            return false;
+        for (std::size_t i = 1; i < chunks.size(); ++i)
+            if (chunks[i] != chunk_t(~chunk_t{0}))
                 return false;
         return true;
     }
 
     [[nodiscard]] constexpr auto any() const noexcept -> bool
     {
-        for (std::size_t i = 0; i < N; ++i)
-            if (test(i))
+        for (std::size_t i = 0; i < chunks.size(); ++i)
+            if (chunks[i] != 0)
                 return true;
         return false;
     }
 
-    [[nodiscard]] constexpr auto none() const noexcept -> bool
+    [[nodiscard]] constexpr auto none() const noexcept -> bool { return !any(); }
+
+    [[nodiscard]] constexpr auto count() const noexcept -> std::size_t
     {
-        for (std::size_t i = 0; i < N; ++i)
-            if (test(i))
-                return false;
-        return true;
+        std::size_t result = 0;
+        for (std::size_t i = 0; i < chunks.size(); ++i)
+            result += std::popcount(chunks[i]);
+        return result;
     }
+    [[nodiscard]] static constexpr auto size() noexcept { return N; }
 
-    [[nodiscard]] constexpr auto count() const noexcept
+    /// The index of the lowest set bit, or npos if there is none.
+    [[nodiscard]] constexpr auto find_first() const noexcept -> std::size_t
     {
-        return std::reduce(chunks.begin(),
-                           chunks.end(),
-                           0,
-                           [](std::size_t cur, chunk_t c) { return cur + std::popcount(c); });
+        for (std::size_t i = 0; i < chunks_size; ++i)
+            if (word(i) != 0)
+                return i * bits_per_chunk + std::countr_zero(word(i));
+        return npos;
+    }
+
+    /// The index of the lowest set bit above pos, or npos if there is none.
+    [[nodiscard]] constexpr auto find_next(std::size_t pos) const noexcept -> std::size_t
+    {
+        if (pos >= N - 1)
+            return npos;
+        ++pos;
+        std::size_t i = pos / bits_per_chunk;
+        chunk_t     w = word(i) & chunk_t(~chunk_t{0} << (pos % bits_per_chunk));
+        while (w == 0)
+        {
+            if (++i == chunks_size)
+                return npos;
+            w = word(i);
+        }
+        return i * bits_per_chunk + std::countr_zero(w);
+    }
+
+    /// The index of the highest set bit, or npos if there is none.
+    [[nodiscard]] constexpr auto find_last() const noexcept -> std::size_t
+    {
+        for (std::size_t i = chunks_size; i > 0; --i)
+            if (word(i - 1) != 0)
+                return i * bits_per_chunk - 1 - std::countl_zero(word(i - 1));
+        return npos;
+    }
+
+    /// The index of the highest set bit below pos, or npos if there is none. Searches the whole set if pos >= N.
+    [[nodiscard]] constexpr auto find_prev(std::size_t pos) const noexcept -> std::size_t
+    {
+        if (pos == 0)
+            return npos;
+        pos           = std::min(pos, N) - 1;
+        std::size_t i = pos / bits_per_chunk;
+        chunk_t     w = word(i) & chunk_t(chunk_t(~chunk_t{0}) >> (bits_per_chunk - 1 - pos % bits_per_chunk));
+        while (w == 0)
+        {
+            if (i == 0)
+                return npos;
+            w = word(--i);
+        }
+        return (i + 1) * bits_per_chunk - 1 - std::countl_zero(w);
+    }
+
+    /// Range over the indices of the set bits, in ascending order
+    [[nodiscard]] constexpr auto set_bits() const noexcept -> std::ranges::subrange<set_bit_iterator>
+    {
+        return {set_bit_iterator{*this, 0}, set_bit_iterator{*this, chunks_size}};
+    }
+
+    /// Calls fn(i) for the index i of each set bit, in ascending order
+    template<typename Fn>
+        requires std::invocable<Fn&, std::size_t>
+    constexpr void for_each_set(Fn fn) const
+    {
+        for (std::size_t i = 0; i < chunks_size; ++i)
+            for (chunk_t w = word(i); w != 0; w &= w - 1u)
+                std::invoke(fn, i * bits_per_chunk + std::countr_zero(w));
     }
-    [[nodiscard]] static constexpr auto size() noexcept { return N; }
 
     [[maybe_unused]] constexpr auto set() noexcept -> bitset&
     {
-        for (std::size_t i = 0; i < N; ++i)
-            set(i);
+        chunks.fill(chunk_t(~chunk_t{0}));
+        chunks.front() = detail::tail_mask<N, chunk_t>;
         return *this;
     }
 
     [[maybe_unused]] constexpr auto set(std::size_t pos, bool value = true) noexcept -> bitset&
     {
         auto&      chunk = detail::chunk_for(*this, pos);
-        auto const n     = pos % detail::bits_per_chunk<N>;
-        chunk            = (chunk & ~(1UL << n)) | (value << n);
+        auto const n     = pos % detail::bits_per_chunk<chunk_t>;
+        chunk            = (chunk & ~(chunk_t{1} << n)) | (chunk_t{value} << n);
         return *this;
     }
 
     [[maybe_unused]] constexpr auto reset() noexcept -> bitset&
     {
-        for (std::size_t i = 0; i < N; ++i)
-            reset(i);
+        chunks.fill(0);
         return *this;
     }
 
@@ -198,16 +404,16 @@ struct bitset
 
     [[maybe_unused]] constexpr auto flip() noexcept -> bitset&
     {
-        for (std::size_t i = 0; i < N; ++i)
-            flip(i);
+        detail::bitset_kernels::invert(chunks.data(), chunks.size());
+        chunks.front() &= detail::tail_mask<N, chunk_t>;
         return *this;
     }
 
     [[maybe_unused]] constexpr auto flip(std::size_t pos) noexcept -> bitset&
     {
         auto&      chunk = detail::chunk_for(*this, pos);
-        auto const n     = pos % detail::bits_per_chunk<N>;
-        chunk ^= 1u << n;
+        auto const n     = pos % detail::bits_per_chunk<chunk_t>;
+        chunk ^= chunk_t{1} << n;
         return *this;
     }
 
@@ -215,12 +421,23 @@ struct bitset
     [[nodiscard]] auto to_string(CharT zero = CharT('0'), CharT one = CharT('1')) const
         -> std::basic_string<CharT, Traits, Allocator>
     {
-        std::basic_string<CharT, Traits, Allocator> str;
-        for (std::size_t i = size(); i > 0; --i)
-            if (test(i - 1))
-                str += one;
-            else
-                str += zero;
+        std::basic_string<CharT, Traits, Allocator> str(N, zero);
+        detail::write_str(*this, str.data(), zero, one);
+        return str;
+    }
+
+    /// Like to_string(), but returns an inplace string that doesn't allocate and can be used in constant expressions
+    template<typename CharT = char, typename Traits = std::char_traits<CharT>>
+    [[nodiscard]] constexpr auto to_inplace_string(CharT zero = CharT('0'), CharT one = CharT('1')) const
+        -> basic_inplace_string<CharT, N, Traits>
+    {
+        basic_inplace_string<CharT, N, Traits> str;
+        str.resize_and_overwrite(N,
+                                 [&](CharT* p, std::size_t)
+                                 {
+                                     detail::write_str(*this, p, zero, one);
+                                     return N;
+                                 });
         return str;
     }
 
@@ -239,28 +456,29 @@ struct bitset
 
         unsigned long long result = 0u;
         for (std::size_t i = 0; i < chunks.size(); ++i)
-            result |= (chunks[chunks.size() - i - 1] << (i * detail::bits_per_chunk<N>));
+            result |= static_cast<unsigned long long>(chunks[chunks.size() - i - 1])
+                      << (i * detail::bits_per_chunk<chunk_t>);
         return result;
     }
 
     constexpr auto operator&=(bitset const& rhs) noexcept -> bitset&
     {
-        for (std::size_t i = 0; i < chunks.size(); ++i)
-            chunks[i] &= rhs.chunks[i];
+        using namespace detail::bitset_kernels;
+        binary<op::and_>(chunks.data(), rhs.chunks.data(), chunks.size());
         return *this;
     }
 
     constexpr auto operator|=(bitset const& rhs) noexcept -> bitset&
     {
-        for (std::size_t i = 0; i < chunks.size(); ++i)
-            chunks[i] |= rhs.chunks[i];
+        using namespace detail::bitset_kernels;
+        binary<op::or_>(chunks.data(), rhs.chunks.data(), chunks.size());
         return *this;
     }
 
     constexpr auto operator^=(bitset const& rhs) noexcept -> bitset&
     {
-        for (std::size_t i = 0; i < chunks.size(); ++i)
-            chunks[i] ^= rhs.chunks[i];
+        using namespace detail::bitset_kernels;
+        binary<op::xor_>(chunks.data(), rhs.chunks.data(), chunks.size());
         return *this;
     }
 
@@ -273,16 +491,11 @@ struct bitset
 
     constexpr auto operator<<=(std::size_t pos) noexcept -> bitset&
     {
-        constexpr auto bits_per_chunk = detail::bits_per_chunk<N>;
-        for (std::size_t i = 0; i < chunks.size(); ++i)
-        {
-            auto const next_chunk     = i + 1 < chunks.size() ? chunks[i + 1] : 0u;
-            auto const bits_from_next = next_chunk >> (bits_per_chunk - pos);
-            auto const shifted        = chunks[i] << pos;
-            chunks[i]                 = shifted | bits_from_next;
-        }
-        if constexpr (N > 0)
-            chunks.front() &= (0xffu >> (bits_per_chunk - N % bits_per_chunk));
+        if (pos >= N)
+            return reset();
+        constexpr auto bits_per_chunk = detail::bits_per_chunk<chunk_t>;
+        detail::bitset_kernels::shift_left(chunks.data(), chunks.size(), pos / bits_per_chunk, pos % bits_per_chunk);
+        chunks.front() &= detail::tail_mask<N, chunk_t>;
         return *this;
     }
 
@@ -295,11 +508,10 @@ struct bitset
 
     constexpr auto operator>>=(std::size_t pos) noexcept -> bitset&
     {
-        for (std::size_t i = chunks.size(); i > 0; --i)
-        {
-            auto const n  = i > 1 ? chunks[i - 2] : 0;
-            chunks[i - 1] = (chunks[i - 1] >> pos) | (n << (detail::bits_per_chunk<N> - pos));
-        }
+        if (pos >= N)
+            return reset();
+        constexpr auto bits_per_chunk = detail::bits_per_chunk<chunk_t>;
+        detail::bitset_kernels::shift_right(chunks.data(), chunks.size(), pos / bits_per_chunk, pos % bits_per_chunk);
         return *this;
     }
 
@@ -310,35 +522,42 @@ struct bitset
         return copy;
     }
 
-    std::array<chunk_t, detail::chunk_size<N>> chunks{};
+    std::array<chunk_t, detail::chunk_size<N, chunk_t>> chunks{};
+
+private:
+    static constexpr std::size_t bits_per_chunk = detail::bits_per_chunk<chunk_t>;
+    static constexpr std::size_t chunks_size    = detail::chunk_size<N, chunk_t>;
+
+    // The i-th chunk counting from the least significant one
+    [[nodiscard]] constexpr auto word(std::size_t i) const noexcept -> chunk_t { return chunks[chunks_size - i - 1]; }
 };
 
-template<std::size_t N>
-constexpr auto operator&(bitset<N> const& lhs, bitset<N> const& rhs) noexcept -> bitset<N>
+template<std::size_t N, std::unsigned_integral Chunk>
+constexpr auto operator&(bitset<N, Chunk> const& lhs, bitset<N, Chunk> const& rhs) noexcept -> bitset<N, Chunk>
 {
     auto copy = lhs;
     copy &= rhs;
     return copy;
 }
 
-template<std::size_t N>
-constexpr auto operator|(bitset<N> const& lhs, bitset<N> const& rhs) noexcept -> bitset<N>
+template<std::size_t N, std::unsigned_integral Chunk>
+constexpr auto operator|(bitset<N, Chunk> const& lhs, bitset<N, Chunk> const& rhs) noexcept -> bitset<N, Chunk>
 {
     auto copy = lhs;
     copy |= rhs;
     return copy;
 }
 
-template<std::size_t N>
-constexpr auto operator^(bitset<N> const& lhs, bitset<N> const& rhs) noexcept -> bitset<N>
+template<std::size_t N, std::unsigned_integral Chunk>
+constexpr auto operator^(bitset<N, Chunk> const& lhs, bitset<N, Chunk> const& rhs) noexcept -> bitset<N, Chunk>
 {
     auto copy = lhs;
     copy ^= rhs;
     return copy;
 }
 
-template<std::size_t N>
-constexpr auto operator<<(std::ostream& os, bitset<N> const& bs) noexcept -> std::ostream&
+template<std::size_t N, std::unsigned_integral Chunk>
+constexpr auto operator<<(std::ostream& os, bitset<N, Chunk> const& bs) noexcept -> std::ostream&
 {
     return os << bs.to_string();
 }
@@ -366,16 +585,16 @@ constexpr auto operator"" _bits() noexcept
 
 namespace std
 {
-template<std::size_t N>
-struct hash<structural::bitset<N>>
+template<std::size_t N, std::unsigned_integral Chunk>
+struct hash<structural::bitset<N, Chunk>>
 {
-    constexpr auto operator()(structural::bitset<N> const& bs) const noexcept -> std::size_t
+    constexpr auto operator()(structural::bitset<N, Chunk> const& bs) const noexcept -> std::size_t
     {
         std::size_t    hash      = 0u;
         constexpr auto max_width = sizeof(std::size_t) * CHAR_BIT;
         for (std::size_t i = 0; i < bs.chunks.size(); ++i)
         {
-            auto const offset = i * sizeof(typename structural::bitset<N>::chunk_t) * CHAR_BIT;
+            auto const offset = i * sizeof(Chunk) * CHAR_BIT;
             hash ^= std::size_t(bs.chunks[bs.chunks.size() - i - 1]) << (offset % max_width);
         }
         return hash;
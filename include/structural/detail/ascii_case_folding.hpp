@@ -0,0 +1,120 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_ASCII_CASE_FOLDING_HPP
+#define STRUCTURAL_ASCII_CASE_FOLDING_HPP
+
+#include <bit>
+#include <string_view>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// ASCII case folding eight characters at a time. Characters outside of ASCII are left alone, so UTF-8 strings fold
+// their ASCII letters and compare everything else byte by byte.
+namespace structural::detail::ascii_case_folding
+{
+inline constexpr std::size_t word_size = sizeof(std::uint64_t);
+
+inline constexpr std::uint64_t ones = 0x0101'0101'0101'0101;
+
+template<typename CharT>
+constexpr auto to_lower(CharT c) noexcept -> CharT
+{
+    return c >= CharT('A') && c <= CharT('Z') ? static_cast<CharT>(c + ('a' - 'A')) : c;
+}
+
+// Lowercases all bytes of w that are ASCII uppercase letters
+constexpr auto to_lower_word(std::uint64_t w) noexcept -> std::uint64_t
+{
+    // Adding to the low seven bits of each byte can't carry into the next byte, and sets the high bit of a byte iff it
+    // is above the bound
+    std::uint64_t const low_bits  = w & (0x7f * ones);
+    std::uint64_t const above_z   = low_bits + (0x7f - 'Z') * ones;
+    std::uint64_t const from_a    = low_bits + (0x80 - 'A') * ones;
+    std::uint64_t const uppercase = from_a & ~above_z & ~w & (0x80 * ones);
+    return w | (uppercase >> 2);
+}
+
+// Loads count <= word_size characters, zero-padded, with the first one in the least significant byte
+constexpr auto load_word(char const* p, std::size_t count) noexcept -> std::uint64_t
+{
+    if (!std::is_constant_evaluated() && std::endian::native == std::endian::little && count == word_size)
+    {
+        std::uint64_t w;
+        std::memcpy(&w, p, word_size);
+        return w;
+    }
+    std::uint64_t w = 0;
+    for (std::size_t i = 0; i < count; ++i)
+        w |= std::uint64_t{static_cast<unsigned char>(p[i])} << (8 * i);
+    return w;
+}
+
+// Length of the common prefix of lhs and rhs in whole words, ignoring case
+constexpr auto equal_words(char const* lhs, char const* rhs, std::size_t count) noexcept -> std::size_t
+{
+    std::size_t i = 0;
+    for (; count - i >= word_size; i += word_size)
+    {
+        if (to_lower_word(load_word(lhs + i, word_size)) != to_lower_word(load_word(rhs + i, word_size)))
+            break;
+    }
+    return i;
+}
+
+constexpr auto equal(std::string_view lhs, std::string_view rhs) noexcept -> bool
+{
+    if (lhs.size() != rhs.size())
+        return false;
+    std::size_t const i = equal_words(lhs.data(), rhs.data(), lhs.size());
+    if (lhs.size() - i >= word_size)
+        return false;
+    return to_lower_word(load_word(lhs.data() + i, lhs.size() - i))
+           == to_lower_word(load_word(rhs.data() + i, rhs.size() - i));
+}
+
+constexpr auto mix(std::uint64_t h) noexcept -> std::uint64_t
+{
+    h ^= h >> 32;
+    h *= 0x9e37'79b9'7f4a'7c15;
+    h ^= h >> 29;
+    return h;
+}
+
+constexpr auto hash(std::string_view sv) noexcept -> std::size_t
+{
+    std::uint64_t h = mix(sv.size());
+    std::size_t   i = 0;
+    for (; sv.size() - i >= word_size; i += word_size)
+        h = mix(h ^ to_lower_word(load_word(sv.data() + i, word_size)));
+    if (i != sv.size())
+        h = mix(h ^ to_lower_word(load_word(sv.data() + i, sv.size() - i)));
+    return static_cast<std::size_t>(h);
+}
+} // namespace structural::detail::ascii_case_folding
+
+#endif // STRUCTURAL_ASCII_CASE_FOLDING_HPP
@@ -0,0 +1,366 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_BITSET_KERNELS_HPP
+#define STRUCTURAL_BITSET_KERNELS_HPP
+
+#include "structural/detail/find_kernels.hpp"
+
+#include <bit>
+#include <concepts>
+#include <type_traits>
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define STRUCTURAL_HAS_AVX2 1
+#else
+#define STRUCTURAL_HAS_AVX2 0
+#endif
+
+// Bulk operations on the chunk array of a bitset.
+//
+// Chunks are stored most significant first, i.e. logical chunk L lives at index n - L - 1. The kernels are constexpr
+// and use plain loops during constant evaluation. At run time they use AVX2 or SSE2 where available; the shifts only
+// vectorize 64-bit chunks.
+namespace structural::detail::bitset_kernels
+{
+#if STRUCTURAL_HAS_AVX2
+using vector = __m256i;
+
+inline auto load(void const* p) noexcept -> vector
+{
+    return _mm256_loadu_si256(static_cast<vector const*>(p));
+}
+inline void store(void* p, vector v) noexcept
+{
+    _mm256_storeu_si256(static_cast<vector*>(p), v);
+}
+inline auto bit_and(vector a, vector b) noexcept -> vector
+{
+    return _mm256_and_si256(a, b);
+}
+inline auto bit_or(vector a, vector b) noexcept -> vector
+{
+    return _mm256_or_si256(a, b);
+}
+inline auto bit_xor(vector a, vector b) noexcept -> vector
+{
+    return _mm256_xor_si256(a, b);
+}
+// a & ~b
+inline auto bit_and_not(vector a, vector b) noexcept -> vector
+{
+    return _mm256_andnot_si256(b, a);
+}
+inline auto all_ones() noexcept -> vector
+{
+    return _mm256_set1_epi32(-1);
+}
+// Shift each 64-bit lane; counts >= 64 yield zero
+inline auto shift_lanes_left(vector v, unsigned count) noexcept -> vector
+{
+    return _mm256_sll_epi64(v, _mm_cvtsi32_si128(static_cast<int>(count)));
+}
+inline auto shift_lanes_right(vector v, unsigned count) noexcept -> vector
+{
+    return _mm256_srl_epi64(v, _mm_cvtsi32_si128(static_cast<int>(count)));
+}
+#define STRUCTURAL_HAS_BITSET_VECTOR 1
+#elif STRUCTURAL_HAS_SSE2
+using vector = __m128i;
+
+inline auto load(void const* p) noexcept -> vector
+{
+    return _mm_loadu_si128(static_cast<vector const*>(p));
+}
+inline void store(void* p, vector v) noexcept
+{
+    _mm_storeu_si128(static_cast<vector*>(p), v);
+}
+inline auto bit_and(vector a, vector b) noexcept -> vector
+{
+    return _mm_and_si128(a, b);
+}
+inline auto bit_or(vector a, vector b) noexcept -> vector
+{
+    return _mm_or_si128(a, b);
+}
+inline auto bit_xor(vector a, vector b) noexcept -> vector
+{
+    return _mm_xor_si128(a, b);
+}
+// a & ~b
+inline auto bit_and_not(vector a, vector b) noexcept -> vector
+{
+    return _mm_andnot_si128(b, a);
+}
+inline auto all_ones() noexcept -> vector
+{
+    return _mm_set1_epi32(-1);
+}
+// Shift each 64-bit lane; counts >= 64 yield zero
+inline auto shift_lanes_left(vector v, unsigned count) noexcept -> vector
+{
+    return _mm_sll_epi64(v, _mm_cvtsi32_si128(static_cast<int>(count)));
+}
+inline auto shift_lanes_right(vector v, unsigned count) noexcept -> vector
+{
+    return _mm_srl_epi64(v, _mm_cvtsi32_si128(static_cast<int>(count)));
+}
+#define STRUCTURAL_HAS_BITSET_VECTOR 1
+#else
+#define STRUCTURAL_HAS_BITSET_VECTOR 0
+#endif
+
+#if STRUCTURAL_HAS_BITSET_VECTOR
+inline constexpr std::size_t vector_words = sizeof(vector) / sizeof(std::uint64_t);
+#endif
+
+enum class op
+{
+    and_,
+    or_,
+    xor_,
+    and_not_, // lhs & ~rhs
+};
+
+template<op Op, std::unsigned_integral Chunk>
+constexpr auto apply(Chunk lhs, Chunk rhs) noexcept -> Chunk
+{
+    if constexpr (Op == op::and_)
+        return lhs & rhs;
+    else if constexpr (Op == op::or_)
+        return lhs | rhs;
+    else if constexpr (Op == op::xor_)
+        return lhs ^ rhs;
+    else
+        return lhs & Chunk(~rhs);
+}
+
+// dst[i] = dst[i] op src[i] for all i < n
+template<op Op, std::unsigned_integral Chunk>
+constexpr void binary(Chunk* dst, Chunk const* src, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+#if STRUCTURAL_HAS_BITSET_VECTOR
+    if (!std::is_constant_evaluated())
+    {
+        constexpr std::size_t step = sizeof(vector) / sizeof(Chunk);
+        for (std::size_t const end = n - n % step; i < end; i += step)
+        {
+            vector const a = load(dst + i);
+            vector const b = load(src + i);
+            if constexpr (Op == op::and_)
+                store(dst + i, bit_and(a, b));
+            else if constexpr (Op == op::or_)
+                store(dst + i, bit_or(a, b));
+            else if constexpr (Op == op::xor_)
+                store(dst + i, bit_xor(a, b));
+            else
+                store(dst + i, bit_and_not(a, b));
+        }
+    }
+#endif
+    for (; i < n; ++i)
+        dst[i] = apply<Op>(dst[i], src[i]);
+}
+
+// dst[i] = ~dst[i] for all i < n
+template<std::unsigned_integral Chunk>
+constexpr void invert(Chunk* dst, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+#if STRUCTURAL_HAS_BITSET_VECTOR
+    if (!std::is_constant_evaluated())
+    {
+        constexpr std::size_t step = sizeof(vector) / sizeof(Chunk);
+        for (std::size_t const end = n - n % step; i < end; i += step)
+            store(dst + i, bit_xor(load(dst + i), all_ones()));
+    }
+#endif
+    for (; i < n; ++i)
+        dst[i] = ~dst[i];
+}
+
+// Shifts the n chunks at w towards the most significant bit by word_shift whole chunks plus bit_shift bits, where
+// bit_shift is smaller than the chunk width. Chunks shifted in are zero.
+template<std::unsigned_integral Chunk>
+constexpr void shift_left(Chunk* w, std::size_t n, std::size_t word_shift, unsigned bit_shift) noexcept
+{
+    constexpr unsigned bits = sizeof(Chunk) * CHAR_BIT;
+
+    // Chunk i receives the high bits from chunk i + word_shift and the carry from the one after it. Sources are never
+    // below i, so ascending order works in place.
+    auto const source = [&](std::size_t j) { return j < n ? w[j] : Chunk{0}; };
+
+    std::size_t i = 0;
+#if STRUCTURAL_HAS_BITSET_VECTOR
+    if constexpr (std::same_as<Chunk, std::uint64_t>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            for (; i + word_shift + vector_words + 1 <= n; i += vector_words)
+            {
+                vector const hi = load(w + i + word_shift);
+                vector const lo = load(w + i + word_shift + 1);
+                store(w + i, bit_or(shift_lanes_left(hi, bit_shift), shift_lanes_right(lo, bits - bit_shift)));
+            }
+        }
+    }
+#endif
+    for (; i < n; ++i)
+    {
+        auto const hi = source(i + word_shift);
+        if (bit_shift == 0)
+            w[i] = hi;
+        else
+            w[i] = Chunk(hi << bit_shift) | Chunk(source(i + word_shift + 1) >> (bits - bit_shift));
+    }
+}
+
+// Shifts the n chunks at w towards the least significant bit by word_shift whole chunks plus bit_shift bits, where
+// bit_shift is smaller than the chunk width. Chunks shifted in are zero.
+template<std::unsigned_integral Chunk>
+constexpr void shift_right(Chunk* w, std::size_t n, std::size_t word_shift, unsigned bit_shift) noexcept
+{
+    constexpr unsigned bits = sizeof(Chunk) * CHAR_BIT;
+
+    // Chunk i - 1 receives the low bits from chunk i - 1 - word_shift and the carry from the one before it. Sources are
+    // never above i - 1, so descending order works in place.
+    auto const source = [&](std::size_t j) { return j < n ? w[j] : Chunk{0}; }; // j wraps around below zero
+
+    std::size_t i = n;
+#if STRUCTURAL_HAS_BITSET_VECTOR
+    if constexpr (std::same_as<Chunk, std::uint64_t>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            for (; i >= word_shift + vector_words + 1; i -= vector_words)
+            {
+                vector const lo = load(w + i - vector_words - word_shift);
+                vector const hi = load(w + i - vector_words - word_shift - 1);
+                store(w + i - vector_words,
+                      bit_or(shift_lanes_right(lo, bit_shift), shift_lanes_left(hi, bits - bit_shift)));
+            }
+        }
+    }
+#endif
+    for (; i > 0; --i)
+    {
+        auto const lo = source(i - 1 - word_shift);
+        if (bit_shift == 0)
+            w[i - 1] = lo;
+        else
+            w[i - 1] = Chunk(lo >> bit_shift) | Chunk(source(i - 2 - word_shift) << (bits - bit_shift));
+    }
+}
+
+// -- text conversion, eight single-byte characters at a time
+//
+// Blocks are handled as little-endian words, i.e. character i is byte i of the word.
+
+inline constexpr std::size_t text_block_size = 8;
+
+inline constexpr std::uint64_t repeated_bytes = 0x0101'0101'0101'0101;
+
+template<typename CharT>
+concept single_byte_char = sizeof(CharT) == 1;
+
+template<single_byte_char CharT>
+constexpr auto load_text_block(CharT const* p) noexcept -> std::uint64_t
+{
+    std::uint64_t word = 0;
+    if (!std::is_constant_evaluated() && std::endian::native == std::endian::little)
+    {
+        std::memcpy(&word, p, text_block_size);
+        return word;
+    }
+    for (std::size_t i = 0; i < text_block_size; ++i)
+        word |= std::uint64_t(static_cast<unsigned char>(p[i])) << (i * CHAR_BIT);
+    return word;
+}
+
+template<single_byte_char CharT>
+constexpr void store_text_block(CharT* p, std::uint64_t word) noexcept
+{
+    if (!std::is_constant_evaluated() && std::endian::native == std::endian::little)
+    {
+        std::memcpy(p, &word, text_block_size);
+        return;
+    }
+    for (std::size_t i = 0; i < text_block_size; ++i)
+        p[i] = static_cast<CharT>(static_cast<unsigned char>(word >> (i * CHAR_BIT)));
+}
+
+// Byte i of the result is 1 if byte i of word equals c, and 0 otherwise
+constexpr auto equal_bytes(std::uint64_t word, unsigned char c) noexcept -> std::uint64_t
+{
+    constexpr std::uint64_t low_bits = 0x7f7f'7f7f'7f7f'7f7f;
+    auto const              x        = word ^ (repeated_bytes * c);
+    auto const              nonzero  = ((x & low_bits) + low_bits) | x; // High bit of each non-zero byte is set
+    return (~nonzero >> 7) & repeated_bytes;
+}
+
+// Packs eight bytes that are 0 or 1 into one byte, byte 0 becoming the most significant bit
+constexpr auto pack_bytes(std::uint64_t bytes) noexcept -> std::uint8_t
+{
+    return static_cast<std::uint8_t>((bytes * 0x8040'2010'0804'0201) >> 56);
+}
+
+// Inverse of pack_bytes()
+constexpr auto unpack_bytes(std::uint8_t bits) noexcept -> std::uint64_t
+{
+    return ((bits * 0x8040'2010'0804'0201) >> 7) & repeated_bytes;
+}
+
+// Parses eight zero/one characters, the first one becoming the most significant bit. Returns false if any character is
+// neither zero nor one.
+template<single_byte_char CharT>
+constexpr auto parse_text_block(CharT const* p, CharT zero, CharT one, std::uint8_t& bits) noexcept -> bool
+{
+    auto const word  = load_text_block(p);
+    auto const ones  = equal_bytes(word, static_cast<unsigned char>(one));
+    auto const zeros = equal_bytes(word, static_cast<unsigned char>(zero));
+    bits             = pack_bytes(ones);
+    return (ones | zeros) == repeated_bytes;
+}
+
+// Writes bits as eight zero/one characters, the most significant bit first
+template<single_byte_char CharT>
+constexpr void format_text_block(CharT* p, std::uint8_t bits, CharT zero, CharT one) noexcept
+{
+    auto const z = static_cast<unsigned char>(zero);
+    auto const o = static_cast<unsigned char>(one);
+    store_text_block(p, (unpack_bytes(bits) * (z ^ o)) ^ (repeated_bytes * z));
+}
+} // namespace structural::detail::bitset_kernels
+
+#undef STRUCTURAL_HAS_BITSET_VECTOR
+
+#endif // STRUCTURAL_BITSET_KERNELS_HPP
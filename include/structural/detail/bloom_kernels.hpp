@@ -0,0 +1,127 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_BLOOM_KERNELS_HPP
+#define STRUCTURAL_BLOOM_KERNELS_HPP
+
+#include "structural/detail/bitset_kernels.hpp"
+
+#include <array>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+// Probes of the blocked Bloom filter.
+//
+// A block is 256 bits, stored as four 64-bit chunks and seen as eight 32-bit words, word j being the low (j even) or
+// high (j odd) half of chunk j / 2. A key sets one bit in each of the first K words; the bit within word j is picked
+// by the top five bits of the key's 32-bit block hash multiplied with an odd salt. At run time the eight words are
+// probed at once with AVX2 where available, otherwise one word at a time.
+namespace structural::detail::bloom_kernels
+{
+inline constexpr std::size_t block_bits   = 256;
+inline constexpr std::size_t block_chunks = block_bits / 64;
+inline constexpr std::size_t block_words  = block_bits / 32;
+
+inline constexpr std::array<std::uint32_t, block_words> salts = {
+    0x47b6'137b, 0x4497'4d91, 0x8824'ad5b, 0xa2b7'289d, 0x7054'95c7, 0x2df1'424b, 0x9efc'4947, 0x5c6b'fb31,
+};
+
+// Spreads the entropy of a hash over all bits; structural::hash is the identity for integers
+constexpr auto mix(std::uint64_t h) noexcept -> std::uint64_t
+{
+    h ^= h >> 33;
+    h *= 0xff51'afd7'ed55'8ccd;
+    h ^= h >> 33;
+    h *= 0xc4ce'b9fe'1a85'ec53;
+    h ^= h >> 33;
+    return h;
+}
+
+// Mask of the bits a key sets in the given chunk of its block
+template<std::size_t K, std::size_t Chunk>
+constexpr auto chunk_mask(std::uint32_t h) noexcept -> std::uint64_t
+{
+    constexpr std::size_t low = 2 * Chunk;
+    std::uint64_t         mask = 0;
+    if constexpr (low < K)
+        mask |= std::uint64_t{1} << (static_cast<std::uint32_t>(h * salts[low]) >> 27);
+    if constexpr (low + 1 < K)
+        mask |= std::uint64_t{1} << ((static_cast<std::uint32_t>(h * salts[low + 1]) >> 27) + 32);
+    return mask;
+}
+
+#if STRUCTURAL_HAS_AVX2
+template<std::size_t K>
+inline auto vector_mask(std::uint32_t h) noexcept -> __m256i
+{
+    __m256i const salt_vector = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(salts.data()));
+    __m256i const bits        = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32(int(h)), salt_vector), 27);
+    __m256i const mask        = _mm256_sllv_epi32(_mm256_set1_epi32(1), bits);
+    if constexpr (K == block_words)
+        return mask;
+    else
+    {
+        __m256i const used_words = _mm256_cmpgt_epi32(_mm256_set1_epi32(int(K)),
+                                                      _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        return _mm256_and_si256(mask, used_words);
+    }
+}
+#endif
+
+// Sets the K bits of a key with block hash h in the block
+template<std::size_t K>
+constexpr void insert(std::uint64_t* block, std::uint32_t h) noexcept
+{
+#if STRUCTURAL_HAS_AVX2
+    if (!std::is_constant_evaluated())
+    {
+        __m256i* const p = reinterpret_cast<__m256i*>(block);
+        _mm256_storeu_si256(p, _mm256_or_si256(_mm256_loadu_si256(p), vector_mask<K>(h)));
+        return;
+    }
+#endif
+    [&]<std::size_t... Chunks>(std::index_sequence<Chunks...>) {
+        ((block[Chunks] |= chunk_mask<K, Chunks>(h)), ...);
+    }(std::make_index_sequence<block_chunks>{});
+}
+
+// Returns whether all K bits of a key with block hash h are set in the block
+template<std::size_t K>
+constexpr auto contains(std::uint64_t const* block, std::uint32_t h) noexcept -> bool
+{
+#if STRUCTURAL_HAS_AVX2
+    if (!std::is_constant_evaluated())
+        return _mm256_testc_si256(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(block)), vector_mask<K>(h));
+#endif
+    // Most probes of a sparse filter are misses, which usually end at the first chunk
+    return [&]<std::size_t... Chunks>(std::index_sequence<Chunks...>) {
+        return (((chunk_mask<K, Chunks>(h) & ~block[Chunks]) == 0) && ...);
+    }(std::make_index_sequence<block_chunks>{});
+}
+} // namespace structural::detail::bloom_kernels
+
+#endif // STRUCTURAL_BLOOM_KERNELS_HPP
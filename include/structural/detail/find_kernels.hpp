@@ -0,0 +1,215 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_FIND_KERNELS_HPP
+#define STRUCTURAL_FIND_KERNELS_HPP
+
+#include <array>
+#include <bit>
+#include <string_view>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define STRUCTURAL_HAS_SSE2 1
+#else
+#define STRUCTURAL_HAS_SSE2 0
+#endif
+
+// Run-time search kernels for byte-sized characters, used by basic_inplace_string.
+//
+// All kernels search the first `size` bytes starting at `p`, but may read up to `readable` bytes from there. This lets
+// callers that own the storage behind the string (like basic_inplace_string does up to its capacity) use full vector
+// loads without a scalar tail.
+namespace structural::detail::find_kernels
+{
+inline constexpr std::size_t npos = -1;
+
+inline constexpr std::size_t block_size = 16;
+
+// Set of bytes for find_first_of and friends. Small sets are matched with one vector compare per element, larger ones
+// fall back to a scalar lookup table.
+struct byte_set
+{
+    static constexpr std::size_t max_vectorized = 8;
+
+    explicit byte_set(std::string_view chars) noexcept
+        : chars(chars)
+    {
+        for (unsigned char c : chars)
+            table[c / 64] |= std::uint64_t{1} << (c % 64);
+    }
+
+    [[nodiscard]] auto contains(char c) const noexcept -> bool
+    {
+        auto const u = static_cast<unsigned char>(c);
+        return (table[u / 64] >> (u % 64)) & 1;
+    }
+
+    std::string_view             chars;
+    std::array<std::uint64_t, 4> table{};
+};
+
+// Bitmask of the bytes among the 16 starting at p that are equal to c
+inline auto equal_mask(char const* p, char c) noexcept -> unsigned
+{
+#if STRUCTURAL_HAS_SSE2
+    __m128i const block = _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8(c))));
+#else
+    unsigned mask = 0;
+    for (std::size_t i = 0; i < block_size; ++i)
+        mask |= unsigned{p[i] == c} << i;
+    return mask;
+#endif
+}
+
+// Bitmask of the bytes among the 16 starting at p that are contained in set
+inline auto set_mask(char const* p, byte_set const& set) noexcept -> unsigned
+{
+    unsigned mask = 0;
+    for (char c : set.chars)
+        mask |= equal_mask(p, c);
+    return mask;
+}
+
+// Index of the first byte for which match() != negate, where block_match() computes the match() bitmask of 16 bytes.
+template<typename BlockMatch, typename Match>
+auto find_first(char const* p, std::size_t size, std::size_t readable, bool negate, BlockMatch block_match, Match match)
+    -> std::size_t
+{
+    std::size_t i = 0;
+    for (; i < size && i + block_size <= readable; i += block_size)
+    {
+        unsigned mask = block_match(p + i);
+        if (negate)
+            mask = ~mask & 0xffff;
+        if (size - i < block_size)
+            mask &= (1u << (size - i)) - 1;
+        if (mask != 0)
+            return i + std::countr_zero(mask);
+    }
+    for (; i < size; ++i)
+    {
+        if (match(p[i]) != negate)
+            return i;
+    }
+    return npos;
+}
+
+// Index of the last byte for which match() != negate, where block_match() computes the match() bitmask of 16 bytes.
+template<typename BlockMatch, typename Match>
+auto find_last(char const* p, std::size_t size, std::size_t readable, bool negate, BlockMatch block_match, Match match)
+    -> std::size_t
+{
+    std::size_t end = size;
+    while (end > 0 && (end >= block_size || readable >= block_size))
+    {
+        std::size_t const first = end >= block_size ? end - block_size : 0;
+        unsigned          mask  = block_match(p + first);
+        if (negate)
+            mask = ~mask & 0xffff;
+        if (end - first < block_size)
+            mask &= (1u << (end - first)) - 1;
+        if (mask != 0)
+            return first + std::bit_width(mask) - 1;
+        end = first;
+    }
+    while (end-- > 0)
+    {
+        if (match(p[end]) != negate)
+            return end;
+    }
+    return npos;
+}
+
+inline auto find_byte(char const* p, std::size_t size, std::size_t readable, char c) noexcept -> std::size_t
+{
+    auto const block_match = [c](char const* b) { return equal_mask(b, c); };
+    auto const match       = [c](char x) { return x == c; };
+    return find_first(p, size, readable, false, block_match, match);
+}
+
+inline auto rfind_byte(char const* p, std::size_t size, std::size_t readable, char c) noexcept -> std::size_t
+{
+    auto const block_match = [c](char const* b) { return equal_mask(b, c); };
+    auto const match       = [c](char x) { return x == c; };
+    return find_last(p, size, readable, false, block_match, match);
+}
+
+// Shared implementation of find_first_of, find_first_not_of, find_last_of and find_last_not_of
+template<bool Last>
+auto find_of(char const* p, std::size_t size, std::size_t readable, std::string_view chars, bool negate) noexcept
+    -> std::size_t
+{
+    byte_set const set(chars);
+    auto const     block_match = [&set](char const* b) { return set_mask(b, set); };
+    auto const     match       = [&set](char x) { return set.contains(x); };
+    if (chars.size() > byte_set::max_vectorized)
+        readable = 0; // Disables the block loop
+    if constexpr (Last)
+        return find_last(p, size, readable, negate, block_match, match);
+    else
+        return find_first(p, size, readable, negate, block_match, match);
+}
+
+// Substring search. Candidates are those positions where both the first and the last byte of the needle match, which
+// are found 16 at a time; only those are compared in full.
+inline auto find(char const* p, std::size_t size, std::size_t readable, std::string_view needle) noexcept
+    -> std::size_t
+{
+    if (needle.empty())
+        return 0;
+    if (needle.size() == 1)
+        return find_byte(p, size, readable, needle.front());
+    if (needle.size() > size)
+        return npos;
+
+    std::size_t const last_start = size - needle.size();
+    std::size_t       i          = 0;
+    for (; i <= last_start && i + needle.size() - 1 + block_size <= readable; i += block_size)
+    {
+        unsigned mask = equal_mask(p + i, needle.front()) & equal_mask(p + i + needle.size() - 1, needle.back());
+        if (last_start - i < block_size)
+            mask &= (2u << (last_start - i)) - 1;
+        for (; mask != 0; mask &= mask - 1)
+        {
+            std::size_t const candidate = i + std::countr_zero(mask);
+            if (std::memcmp(p + candidate + 1, needle.data() + 1, needle.size() - 2) == 0)
+                return candidate;
+        }
+    }
+    for (; i <= last_start; ++i)
+    {
+        if (p[i] == needle.front() && std::memcmp(p + i + 1, needle.data() + 1, needle.size() - 1) == 0)
+            return i;
+    }
+    return npos;
+}
+} // namespace structural::detail::find_kernels
+
+#endif // STRUCTURAL_FIND_KERNELS_HPP
@@ -0,0 +1,85 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_INPLACE_STRING_STORAGE_HPP
+#define STRUCTURAL_INPLACE_STRING_STORAGE_HPP
+
+#include <array>
+#include <type_traits>
+
+#include <cstddef>
+
+namespace structural::detail
+{
+// Small strings store their size as the remaining capacity in the last character, see the compact specialization.
+template<std::size_t Capacity>
+inline constexpr bool compact_inplace_string_storage = Capacity < 256;
+
+// Character array of a basic_inplace_string, which always holds a null terminator behind the last character
+template<typename CharT, std::size_t Capacity, bool Compact = compact_inplace_string_storage<Capacity>>
+struct inplace_string_storage
+{
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t { return count; }
+
+    // Sets the size and writes the terminator. Characters in [0, n) must already have been written.
+    constexpr void set_size(std::size_t n) noexcept
+    {
+        chars[n] = CharT();
+        count    = n;
+    }
+
+    std::array<CharT, Capacity + 1> chars{};
+    std::size_t                     count = 0;
+};
+
+// Stores Capacity - size() in the last character instead of a separate size member. As that character is behind the
+// terminator of any string shorter than Capacity, and a full string's remaining capacity is zero, it doubles as the
+// terminator of a full string.
+template<typename CharT, std::size_t Capacity>
+struct inplace_string_storage<CharT, Capacity, true>
+{
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+    {
+        return Capacity - static_cast<std::make_unsigned_t<CharT>>(chars[Capacity]);
+    }
+
+    // Sets the size and writes the terminator. Characters in [0, n) must already have been written.
+    constexpr void set_size(std::size_t n) noexcept
+    {
+        chars[n]        = CharT();
+        chars[Capacity] = static_cast<CharT>(Capacity - n);
+    }
+
+    static constexpr auto empty_chars() noexcept -> std::array<CharT, Capacity + 1>
+    {
+        std::array<CharT, Capacity + 1> result{};
+        result[Capacity] = static_cast<CharT>(Capacity);
+        return result;
+    }
+
+    std::array<CharT, Capacity + 1> chars = empty_chars();
+};
+} // namespace structural::detail
+
+#endif // STRUCTURAL_INPLACE_STRING_STORAGE_HPP
@@ -43,6 +43,14 @@ struct hasher_t
 
     constexpr auto operator()(Key const& k) const -> std::size_t { return hasher(k); }
     constexpr auto operator()(structural::pair<Key const, T> const& p) const -> std::size_t { return hasher(p.first); }
+
+    // Lets transparent hashers see the key as passed to lookup functions, instead of a converted Key
+    template<typename K>
+        requires requires { typename Hash::is_transparent; }
+    constexpr auto operator()(K const& k) const -> std::size_t
+    {
+        return hasher(k);
+    }
 };
 
 template<typename Key, typename T, typename Equals>
@@ -68,6 +76,14 @@ struct equals_t
         return equals(lhs.first, rhs);
     }
     constexpr auto operator()(Key const& lhs, Key const& rhs) const -> bool { return equals(lhs, rhs); }
+
+    // Lets transparent comparisons see the key as passed to lookup functions, instead of a converted Key
+    template<typename K>
+        requires requires { typename Equals::is_transparent; }
+    constexpr auto operator()(structural::pair<Key const, T> const& lhs, K const& rhs) const -> bool
+    {
+        return equals(lhs.first, rhs);
+    }
 };
 
 template<typename Key, typename T, std::size_t Capacity, typename Hash, typename Equal>
@@ -0,0 +1,106 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_NAME_TABLE_HPP
+#define STRUCTURAL_NAME_TABLE_HPP
+
+#include "structural/detail/perfect_hash.hpp"
+#include "structural/detail/trim.hpp"
+#include "structural/split.hpp"
+
+#include <ctrx/contracts.hpp>
+
+#include <algorithm>
+#include <array>
+#include <string_view>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstdint>
+
+// The enumerator names of an enum declared with STRUCTURAL_MAKE_NAMED_BITSET. They are extracted from the stringized
+// enumerator list once, when the table is built at compile time, and stored back to back in a single character array.
+namespace structural::detail
+{
+// Total length of the names in a comma-separated list, ignoring the spaces around them
+constexpr auto name_list_chars(std::string_view list) noexcept -> std::size_t
+{
+    std::size_t chars = 0;
+    for (std::string_view const name : split(list, ','))
+        chars += trim(name).size();
+    return chars;
+}
+
+template<std::size_t N, std::size_t Chars>
+struct name_table
+{
+    static constexpr std::size_t size       = N;
+    static constexpr std::size_t chars_size = Chars;
+
+    std::array<char, Chars>          chars{};
+    std::array<std::uint32_t, N + 1> offsets{};
+    perfect_hash::table<N>           lookup{};
+
+    [[nodiscard]] constexpr auto name(std::size_t idx) const noexcept -> std::string_view
+    {
+        CTRX_PRECONDITION(idx < N);
+        return {chars.data() + offsets[idx], offsets[idx + 1] - offsets[idx]};
+    }
+
+    // Returns the index of str, or N if it isn't in the table
+    [[nodiscard]] constexpr auto find(std::string_view str) const noexcept -> std::size_t
+    {
+        std::size_t const idx = lookup.candidate(str);
+        if (idx == N || name(idx) != str)
+            return N;
+        return idx;
+    }
+};
+
+template<std::size_t N, std::size_t Chars>
+consteval auto make_name_table(std::string_view list) -> name_table<N, Chars>
+{
+    name_table<N, Chars>            result;
+    std::array<std::string_view, N> names;
+    std::size_t                     idx = 0;
+    for (std::string_view const name : split(list, ','))
+    {
+        names[idx] = trim(name);
+        std::ranges::copy(names[idx], result.chars.begin() + result.offsets[idx]);
+        result.offsets[idx + 1] = result.offsets[idx] + static_cast<std::uint32_t>(names[idx].size());
+        ++idx;
+    }
+    result.lookup = perfect_hash::build(names);
+    return result;
+}
+
+// STRUCTURAL_MAKE_NAMED_BITSET makes the table of an enum available through structural_name_table(), found by ADL
+template<typename Enum>
+concept enum_with_name_table = std::is_enum_v<Enum> && requires(Enum e) { structural_name_table(e); };
+
+template<enum_with_name_table Enum>
+using name_table_of = std::remove_cvref_t<decltype(structural_name_table(Enum{}))>;
+} // namespace structural::detail
+
+#endif // STRUCTURAL_NAME_TABLE_HPP
@@ -0,0 +1,185 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_PERFECT_HASH_HPP
+#define STRUCTURAL_PERFECT_HASH_HPP
+
+#include "structural/detail/ascii_case_folding.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <numeric>
+#include <string_view>
+
+#include <cstddef>
+#include <cstdint>
+
+// A hash-and-displace perfect hash over a set of strings known at compile time. The first level hashes a key into a
+// bucket. The bucket either stores the slot of its only key directly, or a seed for a second-level hash that places all
+// of its keys into distinct free slots.
+namespace structural::detail::perfect_hash
+{
+// Deliberately not constexpr: calling these while building a table makes the error show up at compile time, with the
+// function name as message.
+void perfect_hash_keys_are_not_unique();
+void perfect_hash_found_no_seed();
+
+constexpr auto hash(std::string_view sv, std::uint64_t seed) noexcept -> std::uint64_t
+{
+    using ascii_case_folding::load_word;
+    using ascii_case_folding::mix;
+    using ascii_case_folding::word_size;
+
+    std::uint64_t h = mix((seed * 0x9e37'79b9'7f4a'7c15) ^ sv.size());
+    std::size_t   i = 0;
+    for (; sv.size() - i >= word_size; i += word_size)
+        h = mix(h ^ load_word(sv.data() + i, word_size));
+    if (i != sv.size())
+        h = mix(h ^ load_word(sv.data() + i, sv.size() - i));
+    return h ^ (h >> 31);
+}
+
+template<std::size_t N>
+struct table
+{
+    static constexpr std::size_t size = std::bit_ceil(N == 0 ? std::size_t{1} : N);
+    static constexpr std::size_t mask = size - 1;
+
+    // Seed of the second-level hash, or -(slot + 1) for buckets with a single key
+    std::array<std::int64_t, size> displacements{};
+    // Index of the key stored in a slot, or N for free slots
+    std::array<std::uint32_t, size> slots{};
+
+    /// Returns the index of the only key that may compare equal to key, or N if there is none
+    [[nodiscard]] constexpr auto candidate(std::string_view key) const noexcept -> std::size_t
+    {
+        std::int64_t const d = displacements[hash(key, 0) & mask];
+        if (d < 0)
+            return slots[static_cast<std::size_t>(-d - 1)];
+        return slots[hash(key, static_cast<std::uint64_t>(d)) & mask];
+    }
+};
+
+template<std::size_t N>
+consteval auto build(std::array<std::string_view, N> const& keys) -> table<N>
+{
+    using table_t = table<N>;
+
+    table_t result;
+    result.slots.fill(N);
+
+    // Group the keys by bucket with a counting sort; the keys of bucket b are members[bucket_begin[b]] up to, but not
+    // including, members[bucket_begin[b + 1]]
+    std::array<std::size_t, table_t::size>     bucket_of{};
+    std::array<std::size_t, table_t::size + 1> bucket_begin{};
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        bucket_of[i] = hash(keys[i], 0) & table_t::mask;
+        ++bucket_begin[bucket_of[i] + 1];
+    }
+    std::partial_sum(bucket_begin.begin(), bucket_begin.end(), bucket_begin.begin());
+    std::array<std::size_t, N + 1>         members{};
+    std::array<std::size_t, table_t::size> filled{};
+    for (std::size_t i = 0; i < N; ++i)
+        members[bucket_begin[bucket_of[i]] + filled[bucket_of[i]]++] = i;
+    auto const bucket_size = [&](std::size_t bucket) { return bucket_begin[bucket + 1] - bucket_begin[bucket]; };
+
+    // Equal keys always end up in the same bucket
+    for (std::size_t bucket = 0; bucket < table_t::size; ++bucket)
+    {
+        for (std::size_t i = bucket_begin[bucket]; i < bucket_begin[bucket + 1]; ++i)
+        {
+            for (std::size_t j = bucket_begin[bucket]; j < i; ++j)
+            {
+                if (keys[members[i]] == keys[members[j]])
+                    perfect_hash_keys_are_not_unique();
+            }
+        }
+    }
+
+    // Placing the largest buckets first, while most slots are still free, keeps the seed search short. Buckets hold few
+    // keys, so one pass per bucket size is cheaper than sorting during constant evaluation.
+    std::size_t max_bucket_size = 0;
+    for (std::size_t bucket = 0; bucket < table_t::size; ++bucket)
+        max_bucket_size = std::max(max_bucket_size, bucket_size(bucket));
+    std::array<std::size_t, table_t::size> order{};
+    std::size_t                            order_size = 0;
+    for (std::size_t size = max_bucket_size; size > 0; --size)
+    {
+        for (std::size_t bucket = 0; bucket < table_t::size; ++bucket)
+        {
+            if (bucket_size(bucket) == size)
+                order[order_size++] = bucket;
+        }
+    }
+
+    std::array<bool, table_t::size> taken{};
+    std::array<std::size_t, N + 1>  positions{};
+    std::size_t                     next_free = 0;
+    for (std::size_t k = 0; k < order_size; ++k)
+    {
+        std::size_t const  bucket         = order[k];
+        std::size_t const  count          = bucket_size(bucket);
+        std::size_t const* bucket_members = members.data() + bucket_begin[bucket];
+
+        if (count == 1)
+        {
+            while (taken[next_free])
+                ++next_free;
+            taken[next_free]             = true;
+            result.slots[next_free]      = static_cast<std::uint32_t>(bucket_members[0]);
+            result.displacements[bucket] = -static_cast<std::int64_t>(next_free) - 1;
+            continue;
+        }
+
+        for (std::uint64_t seed = 1;; ++seed)
+        {
+            if (seed > (std::uint64_t{1} << 20))
+                perfect_hash_found_no_seed();
+
+            bool fits = true;
+            for (std::size_t m = 0; m < count && fits; ++m)
+            {
+                auto const previous = positions.begin() + static_cast<std::ptrdiff_t>(m);
+                positions[m]        = hash(keys[bucket_members[m]], seed) & table_t::mask;
+                fits = !taken[positions[m]] && std::find(positions.begin(), previous, positions[m]) == previous;
+            }
+            if (!fits)
+                continue;
+
+            for (std::size_t m = 0; m < count; ++m)
+            {
+                taken[positions[m]]        = true;
+                result.slots[positions[m]] = static_cast<std::uint32_t>(bucket_members[m]);
+            }
+            result.displacements[bucket] = static_cast<std::int64_t>(seed);
+            break;
+        }
+    }
+    return result;
+}
+} // namespace structural::detail::perfect_hash
+
+#endif // STRUCTURAL_PERFECT_HASH_HPP
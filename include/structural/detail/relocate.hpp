@@ -0,0 +1,83 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_RELOCATE_HPP
+#define STRUCTURAL_RELOCATE_HPP
+
+#include <memory>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstring>
+
+namespace structural::detail
+{
+template<typename T>
+concept trivially_relocatable = std::is_trivially_copyable_v<T>;
+
+// Moves the objects in [first, last) to the uninitialized storage starting at dest and ends their lifetime at the
+// source. The ranges may overlap if dest < first.
+template<typename T>
+constexpr void relocate(T* first, T* last, T* dest) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    if (trivially_relocatable<T> && !std::is_constant_evaluated())
+    {
+        if (first != last)
+            std::memmove(static_cast<void*>(dest), static_cast<void const*>(first), (last - first) * sizeof(T));
+    }
+    else
+    {
+        for (; first != last; ++first, ++dest)
+        {
+            std::construct_at(dest, std::move(*first));
+            std::destroy_at(first);
+        }
+    }
+}
+
+// Like relocate(), but the objects are processed back to front, such that the ranges may overlap if d_last > last.
+template<typename T>
+constexpr void relocate_backward(T* first, T* last, T* d_last) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    if (trivially_relocatable<T> && !std::is_constant_evaluated())
+    {
+        if (first != last)
+            std::memmove(static_cast<void*>(d_last - (last - first)),
+                         static_cast<void const*>(first),
+                         (last - first) * sizeof(T));
+    }
+    else
+    {
+        while (last != first)
+        {
+            --last;
+            --d_last;
+            std::construct_at(d_last, std::move(*last));
+            std::destroy_at(last);
+        }
+    }
+}
+} // namespace structural::detail
+
+#endif // STRUCTURAL_RELOCATE_HPP
@@ -0,0 +1,445 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_TO_CHARS_HPP
+#define STRUCTURAL_TO_CHARS_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <limits>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace structural::detail
+{
+template<typename T>
+concept character = std::same_as<T, char> || std::same_as<T, wchar_t> || std::same_as<T, char8_t>
+                    || std::same_as<T, char16_t> || std::same_as<T, char32_t>;
+
+template<typename T>
+concept formattable_integer = std::integral<T> && !std::same_as<T, bool> && !character<T>;
+
+template<typename T>
+concept formattable_floating_point = std::same_as<T, float> || std::same_as<T, double>;
+
+// Maximum number of characters needed to print a value of type T
+template<typename T>
+inline constexpr std::size_t max_chars = 0;
+template<formattable_integer T>
+inline constexpr std::size_t max_chars<T> = std::numeric_limits<T>::digits10 + 1 + std::is_signed_v<T>;
+template<>
+inline constexpr std::size_t max_chars<float> = 15; // -1.17549435e-38
+template<>
+inline constexpr std::size_t max_chars<double> = 24; // -2.2250738585072014e-308
+
+inline constexpr char digit_pairs[] = "00010203040506070809"
+                                      "10111213141516171819"
+                                      "20212223242526272829"
+                                      "30313233343536373839"
+                                      "40414243444546474849"
+                                      "50515253545556575859"
+                                      "60616263646566676869"
+                                      "70717273747576777879"
+                                      "80818283848586878889"
+                                      "90919293949596979899";
+
+template<std::unsigned_integral T>
+constexpr auto count_digits(T value) noexcept -> std::size_t
+{
+    std::size_t n = 1;
+    for (; value >= 10000; value /= 10000)
+        n += 4;
+    return n + (value >= 10) + (value >= 100) + (value >= 1000);
+}
+
+// Writes the decimal representation of value to first, which must have room for max_chars<T> characters. Returns the
+// end of the written range.
+template<formattable_integer T>
+constexpr auto write_integer(char* first, T value) noexcept -> char*
+{
+    using unsigned_t = std::make_unsigned_t<T>;
+    auto magnitude   = static_cast<unsigned_t>(value);
+    if (value < 0)
+    {
+        *first++  = '-';
+        magnitude = static_cast<unsigned_t>(unsigned_t{0} - magnitude);
+    }
+    char* const last = first + count_digits(magnitude);
+    char*       out  = last;
+    for (; magnitude >= 100; magnitude /= 100)
+    {
+        auto const pair = static_cast<std::size_t>(magnitude % 100) * 2;
+        *--out          = digit_pairs[pair + 1];
+        *--out          = digit_pairs[pair];
+    }
+    if (magnitude >= 10)
+    {
+        auto const pair = static_cast<std::size_t>(magnitude) * 2;
+        *--out          = digit_pairs[pair + 1];
+        *--out          = digit_pairs[pair];
+    }
+    else
+        *--out = static_cast<char>('0' + magnitude);
+    return last;
+}
+
+// Unsigned integer of up to 1280 bits, enough for the scaled values of shortest_digits() with doubles
+struct bignum
+{
+    static constexpr std::size_t max_words = 40;
+
+    constexpr explicit bignum(std::uint64_t value) noexcept
+    {
+        for (; value != 0; value >>= 32)
+            words[size++] = static_cast<std::uint32_t>(value);
+    }
+
+    constexpr void shift_left(std::size_t bits) noexcept
+    {
+        std::size_t const word_shift = bits / 32;
+        std::size_t const bit_shift  = bits % 32;
+        if (size == 0)
+            return;
+        std::uint32_t carry = 0;
+        if (bit_shift != 0)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                std::uint32_t const w = words[i];
+                words[i]              = (w << bit_shift) | carry;
+                carry                 = w >> (32 - bit_shift);
+            }
+        }
+        if (carry != 0)
+            words[size++] = carry;
+        std::copy_backward(words.begin(), words.begin() + size, words.begin() + size + word_shift);
+        std::fill(words.begin(), words.begin() + word_shift, 0);
+        size += word_shift;
+    }
+
+    constexpr void multiply(std::uint32_t factor) noexcept
+    {
+        std::uint64_t carry = 0;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            std::uint64_t const product = std::uint64_t{words[i]} * factor + carry;
+            words[i]                    = static_cast<std::uint32_t>(product);
+            carry                       = product >> 32;
+        }
+        if (carry != 0)
+            words[size++] = static_cast<std::uint32_t>(carry);
+    }
+
+    constexpr void multiply_pow10(int exponent) noexcept
+    {
+        for (; exponent >= 9; exponent -= 9)
+            multiply(1'000'000'000);
+        for (; exponent > 0; --exponent)
+            multiply(10);
+    }
+
+    constexpr void add(bignum const& other) noexcept
+    {
+        std::uint64_t carry = 0;
+        std::size_t   i     = 0;
+        for (; i < std::max(size, other.size); ++i)
+        {
+            std::uint64_t const sum = std::uint64_t{words[i]} + other.words[i] + carry;
+            words[i]                = static_cast<std::uint32_t>(sum);
+            carry                   = sum >> 32;
+        }
+        size = i;
+        if (carry != 0)
+            words[size++] = static_cast<std::uint32_t>(carry);
+    }
+
+    // Requires *this >= other
+    constexpr void subtract(bignum const& other) noexcept
+    {
+        std::int64_t borrow = 0;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            std::int64_t const difference = std::int64_t{words[i]} - other.words[i] - borrow;
+            words[i]                      = static_cast<std::uint32_t>(difference);
+            borrow                        = difference < 0;
+        }
+        while (size > 0 && words[size - 1] == 0)
+            --size;
+    }
+
+    // Divides by divisor and returns the remainder
+    constexpr auto divide(std::uint32_t divisor) noexcept -> std::uint32_t
+    {
+        std::uint64_t remainder = 0;
+        for (std::size_t i = size; i-- > 0;)
+        {
+            std::uint64_t const dividend = (remainder << 32) | words[i];
+            words[i]                     = static_cast<std::uint32_t>(dividend / divisor);
+            remainder                    = dividend % divisor;
+        }
+        while (size > 0 && words[size - 1] == 0)
+            --size;
+        return static_cast<std::uint32_t>(remainder);
+    }
+
+    friend constexpr auto compare(bignum const& lhs, bignum const& rhs) noexcept -> int
+    {
+        if (lhs.size != rhs.size)
+            return lhs.size < rhs.size ? -1 : 1;
+        for (std::size_t i = lhs.size; i-- > 0;)
+        {
+            if (lhs.words[i] != rhs.words[i])
+                return lhs.words[i] < rhs.words[i] ? -1 : 1;
+        }
+        return 0;
+    }
+
+    std::array<std::uint32_t, max_words> words{};
+    std::size_t                          size = 0;
+};
+
+struct decimal_digits
+{
+    std::array<char, 17> digits{};
+    std::size_t          count    = 0;
+    int                  exponent = 0; // The value is 0.d1d2d3... * 10^exponent
+};
+
+struct binary_float
+{
+    std::uint64_t mantissa          = 0;
+    int           exponent          = 0; // The value is mantissa * 2^exponent
+    bool          lower_gap_smaller = false;
+};
+
+template<formattable_floating_point T>
+constexpr auto decompose(T value) noexcept -> binary_float
+{
+    using bits_t                        = std::conditional_t<std::same_as<T, float>, std::uint32_t, std::uint64_t>;
+    constexpr int         mantissa_bits = std::numeric_limits<T>::digits - 1;
+    constexpr int         exponent_bias = std::numeric_limits<T>::max_exponent - 1 + mantissa_bits;
+    constexpr std::size_t exponent_bits = sizeof(T) * 8 - 1 - mantissa_bits;
+
+    auto const bits     = std::bit_cast<bits_t>(value);
+    auto const biased_e = static_cast<int>((bits >> mantissa_bits) & ((bits_t{1} << exponent_bits) - 1));
+    auto const fraction = static_cast<std::uint64_t>(bits & ((bits_t{1} << mantissa_bits) - 1));
+    if (biased_e == 0)
+        return {fraction, 1 - exponent_bias, false};
+    return {
+        fraction | (std::uint64_t{1} << mantissa_bits),
+        biased_e - exponent_bias,
+        fraction == 0 && biased_e > 1,
+    };
+}
+
+// Shortest digit string that rounds back to value, using the free-format algorithm by Burger and Dybvig. Slow but
+// exact, which makes it usable in constant expressions where std::to_chars isn't.
+template<formattable_floating_point T>
+constexpr auto shortest_digits(T value) noexcept -> decimal_digits
+{
+    auto const [f, e, lower_gap_smaller] = decompose(value);
+
+    bool const even = f % 2 == 0;
+
+    // value = r / s, and the rounding interval is [value - m_minus / s, value + m_plus / s]
+    bignum r(f);
+    bignum s(1);
+    bignum m_plus(1);
+    bignum m_minus(1);
+    if (e >= 0)
+    {
+        r.shift_left(static_cast<std::size_t>(e) + 1 + lower_gap_smaller);
+        s.shift_left(1 + lower_gap_smaller);
+        m_plus.shift_left(static_cast<std::size_t>(e) + lower_gap_smaller);
+        m_minus.shift_left(static_cast<std::size_t>(e));
+    }
+    else
+    {
+        r.shift_left(1 + lower_gap_smaller);
+        s.shift_left(static_cast<std::size_t>(-e) + 1 + lower_gap_smaller);
+        m_plus.shift_left(lower_gap_smaller);
+    }
+
+    // Estimate the decimal exponent, then fix it up if it was one too small
+    double const estimate = (e + static_cast<int>(std::bit_width(f)) - 1) * 0.30102999566398114;
+    int          k        = static_cast<int>(estimate);
+    if (k < estimate)
+        ++k;
+    if (k >= 0)
+        s.multiply_pow10(k);
+    else
+    {
+        r.multiply_pow10(-k);
+        m_plus.multiply_pow10(-k);
+        m_minus.multiply_pow10(-k);
+    }
+    auto const above_high = [&](bignum const& remainder)
+    {
+        bignum high = remainder;
+        high.add(m_plus);
+        int const c = compare(high, s);
+        return even ? c >= 0 : c > 0;
+    };
+    if (above_high(r))
+    {
+        s.multiply(10);
+        ++k;
+    }
+
+    decimal_digits result;
+    result.exponent = k;
+    while (true)
+    {
+        r.multiply(10);
+        m_plus.multiply(10);
+        m_minus.multiply(10);
+        char digit = 0;
+        while (compare(r, s) >= 0)
+        {
+            r.subtract(s);
+            ++digit;
+        }
+        int const  c_low = compare(r, m_minus);
+        bool const low   = even ? c_low <= 0 : c_low < 0;
+        bool const high  = above_high(r);
+        if (low && high)
+        {
+            bignum twice = r;
+            twice.shift_left(1);
+            int const c = compare(twice, s);
+            if (c > 0 || (c == 0 && digit % 2 != 0))
+                ++digit;
+        }
+        else if (high)
+            ++digit;
+        result.digits[result.count++] = static_cast<char>('0' + digit);
+        if (low || high)
+            break;
+    }
+
+    // Rounding up may have produced a ten in the last place
+    for (std::size_t i = result.count; i-- > 1 && result.digits[i] > '9';)
+    {
+        result.digits[i] = '0';
+        ++result.digits[i - 1];
+        --result.count;
+    }
+    if (result.digits[0] > '9')
+    {
+        result.digits[0] = '1';
+        result.count     = 1;
+        ++result.exponent;
+    }
+    return result;
+}
+
+// Constant-evaluable equivalent of std::to_chars(first, last, value). first must have room for max_chars<T>
+// characters. Returns the end of the written range.
+template<formattable_floating_point T>
+constexpr auto write_shortest(char* first, T value) noexcept -> char*
+{
+    using bits_t = std::conditional_t<std::same_as<T, float>, std::uint32_t, std::uint64_t>;
+    if (std::bit_cast<bits_t>(value) >> (sizeof(T) * 8 - 1) != 0)
+    {
+        *first++ = '-';
+        value    = -value;
+    }
+    if (value != value)
+        return std::copy_n("nan", 3, first);
+    if (value == std::numeric_limits<T>::infinity())
+        return std::copy_n("inf", 3, first);
+    if (value == 0)
+    {
+        *first = '0';
+        return first + 1;
+    }
+
+    auto const [digits, count, k] = shortest_digits(value);
+    auto const n                  = static_cast<int>(count);
+
+    int const sci_exponent = k - 1;
+    int const abs_sci_exp  = sci_exponent < 0 ? -sci_exponent : sci_exponent;
+    int const sci_length   = n + (n > 1) + 2 + (abs_sci_exp >= 100 ? 3 : 2);
+    int const fixed_length = k <= 0 ? 2 - k + n : (k < n ? n + 1 : k);
+    if (fixed_length <= sci_length)
+    {
+        if (k <= 0)
+        {
+            first = std::copy_n("0.", 2, first);
+            first = std::fill_n(first, -k, '0');
+            return std::copy_n(digits.begin(), n, first);
+        }
+        if (k < n)
+        {
+            first    = std::copy_n(digits.begin(), k, first);
+            *first++ = '.';
+            return std::copy_n(digits.begin() + k, n - k, first);
+        }
+        // Like std::to_chars, print the exact integer instead of padding the shortest digits with zeros
+        auto const [f, e, _] = decompose(value);
+        bignum exact(e < 0 ? f >> -e : f);
+        exact.shift_left(static_cast<std::size_t>(std::max(e, 0)));
+        std::array<char, max_chars<T>> reversed{};
+        std::size_t                    length = 0;
+        while (exact.size != 0)
+        {
+            std::uint32_t chunk = exact.divide(1'000'000'000);
+            for (int i = 0; i < 9 && (chunk != 0 || exact.size != 0); ++i, chunk /= 10)
+                reversed[length++] = static_cast<char>('0' + chunk % 10);
+        }
+        return std::reverse_copy(reversed.begin(), reversed.begin() + length, first);
+    }
+
+    *first++ = digits[0];
+    if (n > 1)
+    {
+        *first++ = '.';
+        first    = std::copy_n(digits.begin() + 1, n - 1, first);
+    }
+    *first++ = 'e';
+    *first++ = sci_exponent < 0 ? '-' : '+';
+    if (abs_sci_exp >= 100)
+        *first++ = static_cast<char>('0' + abs_sci_exp / 100);
+    *first++ = digit_pairs[(abs_sci_exp % 100) * 2];
+    *first++ = digit_pairs[(abs_sci_exp % 100) * 2 + 1];
+    return first;
+}
+
+// Writes the shortest representation of value that round-trips, formatted like std::to_chars(first, last, value).
+// first must have room for max_chars<T> characters. Returns the end of the written range.
+template<formattable_floating_point T>
+constexpr auto write_floating_point(char* first, T value) noexcept -> char*
+{
+    if (std::is_constant_evaluated())
+        return write_shortest(first, value);
+    return std::to_chars(first, first + max_chars<T>, value).ptr;
+}
+} // namespace structural::detail
+
+#endif // STRUCTURAL_TO_CHARS_HPP
@@ -0,0 +1,571 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_UTF_KERNELS_HPP
+#define STRUCTURAL_UTF_KERNELS_HPP
+
+#include "structural/detail/find_kernels.hpp"
+
+#include <bit>
+#include <concepts>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#define STRUCTURAL_HAS_SSSE3 1
+#else
+#define STRUCTURAL_HAS_SSSE3 0
+#endif
+
+// Validation, counting and transcoding of UTF-8, UTF-16 and UTF-32.
+//
+// The scalar kernels are constexpr and work for any code unit type. The run-time kernels are for UTF-8 input only and
+// process 16 bytes at a time: validation uses the lookup tables of Keiser & Lemire, "Validating UTF-8 In Less Than One
+// Instruction Per Byte" if SSSE3 is available, and skips ASCII blocks otherwise.
+namespace structural::detail::utf
+{
+template<typename T>
+concept utf8_char = std::same_as<T, char> || std::same_as<T, char8_t>;
+
+template<typename T>
+concept utf_char = utf8_char<T> || std::same_as<T, char16_t> || std::same_as<T, char32_t>;
+
+// The maximum number of To code units that `size` From code units can transcode to
+template<utf_char From, utf_char To>
+constexpr auto max_transcoded_size(std::size_t size) noexcept -> std::size_t
+{
+    if constexpr (sizeof(From) == 2 && sizeof(To) == 1)
+        return 3 * size;
+    else if constexpr (sizeof(From) == 4 && sizeof(To) == 1)
+        return 4 * size;
+    else if constexpr (sizeof(From) == 4 && sizeof(To) == 2)
+        return 2 * size;
+    else
+        return size;
+}
+
+template<utf8_char CharT>
+constexpr auto byte(CharT c) noexcept -> std::uint8_t
+{
+    return static_cast<std::uint8_t>(c);
+}
+
+constexpr auto is_continuation(std::uint8_t b) noexcept -> bool
+{
+    return (b & 0xc0) == 0x80;
+}
+
+constexpr auto is_surrogate(char32_t cp) noexcept -> bool
+{
+    return cp >= 0xd800 && cp <= 0xdfff;
+}
+
+// -- scalar kernels
+
+// Length of the well-formed UTF-8 sequence starting at p, or 0 if there is none. Implements table 3-7 of the Unicode
+// standard.
+template<utf8_char CharT>
+constexpr auto utf8_sequence_length(CharT const* p, std::size_t remaining) noexcept -> std::size_t
+{
+    std::uint8_t const b0 = byte(p[0]);
+    if (b0 < 0x80)
+        return 1;
+
+    std::size_t  length = 0;
+    std::uint8_t lo     = 0x80;
+    std::uint8_t hi     = 0xbf;
+    if (b0 >= 0xc2 && b0 <= 0xdf)
+        length = 2;
+    else if (b0 >= 0xe0 && b0 <= 0xef)
+    {
+        length = 3;
+        lo     = b0 == 0xe0 ? 0xa0 : lo; // Overlong
+        hi     = b0 == 0xed ? 0x9f : hi; // Surrogate
+    }
+    else if (b0 >= 0xf0 && b0 <= 0xf4)
+    {
+        length = 4;
+        lo     = b0 == 0xf0 ? 0x90 : lo; // Overlong
+        hi     = b0 == 0xf4 ? 0x8f : hi; // Above U+10FFFF
+    }
+    else
+        return 0;
+
+    if (remaining < length)
+        return 0;
+    if (std::uint8_t const b1 = byte(p[1]); b1 < lo || b1 > hi)
+        return 0;
+    for (std::size_t i = 2; i < length; ++i)
+    {
+        if (!is_continuation(byte(p[i])))
+            return 0;
+    }
+    return length;
+}
+
+template<utf_char CharT>
+constexpr auto validate_scalar(CharT const* p, std::size_t size) noexcept -> bool
+{
+    if constexpr (sizeof(CharT) == 1)
+    {
+        for (std::size_t i = 0; i < size;)
+        {
+            std::size_t const length = utf8_sequence_length(p, size - i);
+            if (length == 0)
+                return false;
+            p += length;
+            i += length;
+        }
+    }
+    else if constexpr (sizeof(CharT) == 2)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            if (p[i] >= 0xdc00 && p[i] <= 0xdfff)
+                return false;
+            if (p[i] >= 0xd800 && p[i] <= 0xdbff)
+            {
+                if (++i == size || p[i] < 0xdc00 || p[i] > 0xdfff)
+                    return false;
+            }
+        }
+    }
+    else
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            if (p[i] > 0x10ffff || is_surrogate(p[i]))
+                return false;
+        }
+    }
+    return true;
+}
+
+// Number of code points in valid UTF-8
+template<utf8_char CharT>
+constexpr auto utf8_length_scalar(CharT const* p, std::size_t size) noexcept -> std::size_t
+{
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < size; ++i)
+        count += !is_continuation(byte(p[i]));
+    return count;
+}
+
+// Number of UTF-16 code units needed for valid UTF-8
+template<utf8_char CharT>
+constexpr auto utf16_length_scalar(CharT const* p, std::size_t size) noexcept -> std::size_t
+{
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < size; ++i)
+        count += !is_continuation(byte(p[i])) + (byte(p[i]) >= 0xf0);
+    return count;
+}
+
+// Decodes the code point starting at p[i] of valid input and advances i past it
+template<utf_char CharT>
+constexpr auto decode(CharT const* p, std::size_t& i) noexcept -> char32_t
+{
+    if constexpr (sizeof(CharT) == 1)
+    {
+        std::uint8_t const b0 = byte(p[i]);
+        if (b0 < 0x80)
+        {
+            i += 1;
+            return b0;
+        }
+        if (b0 < 0xe0)
+        {
+            i += 2;
+            return (char32_t{b0} & 0x1f) << 6 | (byte(p[i - 1]) & 0x3f);
+        }
+        if (b0 < 0xf0)
+        {
+            i += 3;
+            return (char32_t{b0} & 0x0f) << 12 | (char32_t{byte(p[i - 2])} & 0x3f) << 6 | (byte(p[i - 1]) & 0x3f);
+        }
+        i += 4;
+        return (char32_t{b0} & 0x07) << 18 | (char32_t{byte(p[i - 3])} & 0x3f) << 12
+               | (char32_t{byte(p[i - 2])} & 0x3f) << 6 | (byte(p[i - 1]) & 0x3f);
+    }
+    else if constexpr (sizeof(CharT) == 2)
+    {
+        char32_t const u0 = p[i++];
+        if (u0 < 0xd800 || u0 > 0xdbff)
+            return u0;
+        return 0x10000 + ((u0 - 0xd800) << 10 | (p[i++] - 0xdc00));
+    }
+    else
+        return p[i++];
+}
+
+// Encodes a code point at out and returns the position behind it
+template<utf_char CharT>
+constexpr auto encode(char32_t cp, CharT* out) noexcept -> CharT*
+{
+    if constexpr (sizeof(CharT) == 1)
+    {
+        if (cp < 0x80)
+        {
+            *out++ = static_cast<CharT>(cp);
+        }
+        else if (cp < 0x800)
+        {
+            *out++ = static_cast<CharT>(0xc0 | cp >> 6);
+            *out++ = static_cast<CharT>(0x80 | (cp & 0x3f));
+        }
+        else if (cp < 0x10000)
+        {
+            *out++ = static_cast<CharT>(0xe0 | cp >> 12);
+            *out++ = static_cast<CharT>(0x80 | (cp >> 6 & 0x3f));
+            *out++ = static_cast<CharT>(0x80 | (cp & 0x3f));
+        }
+        else
+        {
+            *out++ = static_cast<CharT>(0xf0 | cp >> 18);
+            *out++ = static_cast<CharT>(0x80 | (cp >> 12 & 0x3f));
+            *out++ = static_cast<CharT>(0x80 | (cp >> 6 & 0x3f));
+            *out++ = static_cast<CharT>(0x80 | (cp & 0x3f));
+        }
+    }
+    else if constexpr (sizeof(CharT) == 2)
+    {
+        if (cp < 0x10000)
+        {
+            *out++ = static_cast<CharT>(cp);
+        }
+        else
+        {
+            *out++ = static_cast<CharT>(0xd800 + ((cp - 0x10000) >> 10));
+            *out++ = static_cast<CharT>(0xdc00 + ((cp - 0x10000) & 0x3ff));
+        }
+    }
+    else
+        *out++ = cp;
+    return out;
+}
+
+// Number of To code units needed for valid From input
+template<utf_char To, utf_char From>
+constexpr auto transcoded_length_scalar(From const* p, std::size_t size) noexcept -> std::size_t
+{
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < size;)
+    {
+        char32_t const cp = decode(p, i);
+        if constexpr (sizeof(To) == 1)
+            count += 1 + (cp >= 0x80) + (cp >= 0x800) + (cp >= 0x10000);
+        else if constexpr (sizeof(To) == 2)
+            count += 1 + (cp >= 0x10000);
+        else
+            count += 1;
+    }
+    return count;
+}
+
+// Transcodes valid input and returns the end of the output
+template<utf_char From, utf_char To>
+constexpr auto transcode_scalar(From const* p, std::size_t size, To* out) noexcept -> To*
+{
+    for (std::size_t i = 0; i < size;)
+        out = encode(decode(p, i), out);
+    return out;
+}
+
+// -- run-time kernels
+
+using find_kernels::block_size;
+
+#if STRUCTURAL_HAS_SSE2
+inline auto load_block(void const* p) noexcept -> __m128i
+{
+    return _mm_loadu_si128(static_cast<__m128i const*>(p));
+}
+
+// Bitmask of the non-ASCII bytes in the block
+inline auto non_ascii_mask(__m128i block) noexcept -> unsigned
+{
+    return static_cast<unsigned>(_mm_movemask_epi8(block));
+}
+#endif
+
+#if STRUCTURAL_HAS_SSSE3
+// Keiser & Lemire's validator. Every error in a pair of consecutive bytes sets a bit in the intersection of three
+// tables, indexed by the high and low nibble of the first byte and the high nibble of the second one.
+class utf8_checker
+{
+public:
+    void check(__m128i input) noexcept
+    {
+        if (non_ascii_mask(input) == 0)
+        {
+            error      = _mm_or_si128(error, prev_incomplete);
+            prev_input = input;
+            return;
+        }
+
+        __m128i const prev1         = _mm_alignr_epi8(input, prev_input, 15);
+        __m128i const special_cases = _mm_and_si128(_mm_and_si128(lookup(byte_1_high, high_nibbles(prev1)),
+                                                                  lookup(byte_1_low, _mm_and_si128(prev1, low_nibble))),
+                                                    lookup(byte_2_high, high_nibbles(input)));
+
+        // Third and fourth bytes of a sequence must be continuations, which the tables can't see as they only look at
+        // pairs. Those are the positions where two continuations in a row are fine.
+        __m128i const prev2          = _mm_alignr_epi8(input, prev_input, 14);
+        __m128i const prev3          = _mm_alignr_epi8(input, prev_input, 13);
+        __m128i const is_third_byte  = _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xe0 - 0x80)));
+        __m128i const is_fourth_byte = _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xf0 - 0x80)));
+        __m128i const must_be_continuation
+            = _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte), _mm_set1_epi8(static_cast<char>(0x80)));
+
+        error           = _mm_or_si128(error, _mm_xor_si128(must_be_continuation, special_cases));
+        prev_incomplete = _mm_subs_epu8(input, incomplete_max);
+        prev_input      = input;
+    }
+
+    // Whether any error was found, including a sequence cut off by the end of the input
+    [[nodiscard]] auto has_error() const noexcept -> bool
+    {
+        __m128i const all = _mm_or_si128(error, prev_incomplete);
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(all, _mm_setzero_si128())) != 0xffff;
+    }
+
+private:
+    static constexpr std::uint8_t too_short      = 1 << 0; // 11______ 0_______
+    static constexpr std::uint8_t too_long       = 1 << 1; // 0_______ 10______
+    static constexpr std::uint8_t overlong_3     = 1 << 2; // 11100000 100_____
+    static constexpr std::uint8_t too_large      = 1 << 3; // 11110100 1001____, 11110101+ 10______
+    static constexpr std::uint8_t surrogate      = 1 << 4; // 11101101 101_____
+    static constexpr std::uint8_t overlong_2     = 1 << 5; // 1100000_ 10______
+    static constexpr std::uint8_t too_large_1000 = 1 << 6; // 11110101+ 1000____
+    static constexpr std::uint8_t overlong_4     = 1 << 6; // 11110000 1000____
+    static constexpr std::uint8_t two_conts      = 1 << 7; // 10______ 10______
+    static constexpr std::uint8_t carry          = too_short | too_long | two_conts;
+
+    static auto high_nibbles(__m128i v) noexcept -> __m128i
+    {
+        return _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0f));
+    }
+
+    static auto lookup(__m128i table, __m128i nibbles) noexcept -> __m128i { return _mm_shuffle_epi8(table, nibbles); }
+
+    static auto make_table(std::uint8_t const (&t)[16]) noexcept -> __m128i { return load_block(t); }
+
+    static constexpr std::uint8_t byte_1_high_table[16]{
+        too_long,
+        too_long,
+        too_long,
+        too_long,
+        too_long,
+        too_long,
+        too_long,
+        too_long,
+        two_conts,
+        two_conts,
+        two_conts,
+        two_conts,
+        too_short | overlong_2,
+        too_short,
+        too_short | overlong_3 | surrogate,
+        too_short | too_large | too_large_1000 | overlong_4,
+    };
+    static constexpr std::uint8_t byte_1_low_table[16]{
+        carry | overlong_3 | overlong_2 | overlong_4,
+        carry | overlong_2,
+        carry,
+        carry,
+        carry | too_large,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000 | surrogate,
+        carry | too_large | too_large_1000,
+        carry | too_large | too_large_1000,
+    };
+    static constexpr std::uint8_t byte_2_high_table[16]{
+        too_short,
+        too_short,
+        too_short,
+        too_short,
+        too_short,
+        too_short,
+        too_short,
+        too_short,
+        too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4,
+        too_long | overlong_2 | two_conts | overlong_3 | too_large,
+        too_long | overlong_2 | two_conts | surrogate | too_large,
+        too_long | overlong_2 | two_conts | surrogate | too_large,
+        too_short,
+        too_short,
+        too_short,
+        too_short,
+    };
+    // A block ends in an incomplete sequence if any of its last three bytes is a leading byte whose sequence doesn't
+    // fit into the block
+    static constexpr std::uint8_t incomplete_max_table[16]{
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0 - 1, 0xe0 - 1, 0xc0 - 1,
+    };
+
+    __m128i const byte_1_high    = make_table(byte_1_high_table);
+    __m128i const byte_1_low     = make_table(byte_1_low_table);
+    __m128i const byte_2_high    = make_table(byte_2_high_table);
+    __m128i const incomplete_max = make_table(incomplete_max_table);
+    __m128i const low_nibble     = _mm_set1_epi8(0x0f);
+
+    __m128i error           = _mm_setzero_si128();
+    __m128i prev_input      = _mm_setzero_si128();
+    __m128i prev_incomplete = _mm_setzero_si128();
+};
+
+inline auto validate_utf8(char const* p, std::size_t size) noexcept -> bool
+{
+    utf8_checker checker;
+    std::size_t  i = 0;
+    for (; i + block_size <= size; i += block_size)
+        checker.check(load_block(p + i));
+    if (i < size)
+    {
+        // Zero padding is ASCII, so it reports a sequence cut off by the end of the input as too short
+        char tail[block_size]{};
+        std::memcpy(tail, p + i, size - i);
+        checker.check(load_block(tail));
+    }
+    return !checker.has_error();
+}
+#else
+inline auto validate_utf8(char const* p, std::size_t size) noexcept -> bool
+{
+    std::size_t i = 0;
+    while (i < size)
+    {
+#if STRUCTURAL_HAS_SSE2
+        if (i + block_size <= size && non_ascii_mask(load_block(p + i)) == 0)
+        {
+            i += block_size;
+            continue;
+        }
+#endif
+        // Validates at least one block in scalar code, ending on a sequence boundary
+        std::size_t const block_end = i + block_size;
+        while (i < size && i < block_end)
+        {
+            std::size_t const length = utf8_sequence_length(p + i, size - i);
+            if (length == 0)
+                return false;
+            i += length;
+        }
+    }
+    return true;
+}
+#endif
+
+inline auto utf8_length(char const* p, std::size_t size) noexcept -> std::size_t
+{
+    std::size_t count = 0;
+    std::size_t i     = 0;
+#if STRUCTURAL_HAS_SSE2
+    // Continuation bytes are the signed values [-128, -65]
+    __m128i const last_continuation = _mm_set1_epi8(-65);
+    for (; i + block_size <= size; i += block_size)
+    {
+        __m128i const leading = _mm_cmpgt_epi8(load_block(p + i), last_continuation);
+        count += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(_mm_movemask_epi8(leading))));
+    }
+#endif
+    return count + utf8_length_scalar(p + i, size - i);
+}
+
+inline auto utf16_length(char const* p, std::size_t size) noexcept -> std::size_t
+{
+    std::size_t count = 0;
+    std::size_t i     = 0;
+#if STRUCTURAL_HAS_SSE2
+    // Leading bytes of four byte sequences are the signed values [-16, -1] and need a surrogate pair
+    __m128i const last_continuation = _mm_set1_epi8(-65);
+    __m128i const first_four_byte   = _mm_set1_epi8(-17);
+    for (; i + block_size <= size; i += block_size)
+    {
+        __m128i const block     = load_block(p + i);
+        __m128i const leading   = _mm_cmpgt_epi8(block, last_continuation);
+        __m128i const four_byte = _mm_and_si128(_mm_cmpgt_epi8(block, first_four_byte),
+                                                _mm_cmplt_epi8(block, _mm_setzero_si128()));
+        count += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(_mm_movemask_epi8(leading))));
+        count += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(_mm_movemask_epi8(four_byte))));
+    }
+#endif
+    return count + utf16_length_scalar(p + i, size - i);
+}
+
+// Transcodes valid UTF-8 to UTF-16 or UTF-32. Blocks of ASCII are widened 16 bytes at a time; everything else is decoded
+// one code point at a time, up to the end of the block it starts in.
+template<typename To>
+    requires(sizeof(To) > 1)
+auto transcode_utf8(char const* p, std::size_t size, To* out) noexcept -> To*
+{
+    std::size_t i = 0;
+    while (i < size)
+    {
+#if STRUCTURAL_HAS_SSE2
+        if (i + block_size <= size)
+        {
+            __m128i const block = load_block(p + i);
+            if (non_ascii_mask(block) == 0)
+            {
+                __m128i const zero = _mm_setzero_si128();
+                __m128i const lo   = _mm_unpacklo_epi8(block, zero);
+                __m128i const hi   = _mm_unpackhi_epi8(block, zero);
+                if constexpr (sizeof(To) == 2)
+                {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), lo);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), hi);
+                }
+                else
+                {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi16(lo, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4), _mm_unpackhi_epi16(lo, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_unpacklo_epi16(hi, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 12), _mm_unpackhi_epi16(hi, zero));
+                }
+                i += block_size;
+                out += block_size;
+                continue;
+            }
+        }
+#endif
+        std::size_t const block_end = i + block_size;
+        while (i < size && i < block_end)
+            out = encode(decode(p, i), out);
+    }
+    return out;
+}
+} // namespace structural::detail::utf
+
+#endif // STRUCTURAL_UTF_KERNELS_HPP
@@ -0,0 +1,109 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_WORD_COMPARE_HPP
+#define STRUCTURAL_WORD_COMPARE_HPP
+
+#include <bit>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Comparison of fixed-size byte arrays eight bytes at a time. The number of words is a compile-time constant, so the
+// loops unroll completely and the only branch left is on the result. Only usable at run time.
+namespace structural::detail::word_compare
+{
+inline constexpr std::size_t word_size = sizeof(std::uint64_t);
+
+constexpr auto byteswap(std::uint64_t w) noexcept -> std::uint64_t
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(w);
+#else
+    std::uint64_t result = 0;
+    for (std::size_t i = 0; i < word_size; ++i, w >>= 8)
+        result = (result << 8) | (w & 0xff);
+    return result;
+#endif
+}
+
+// Loads Count <= word_size bytes, zero-padded, as a word whose most significant byte is the first one. Such words order
+// like the bytes they were loaded from.
+template<std::size_t Count = word_size>
+inline auto load_big_endian(void const* p) noexcept -> std::uint64_t
+{
+    std::uint64_t w = 0;
+    std::memcpy(&w, p, Count);
+    if constexpr (std::endian::native == std::endian::little)
+        w = byteswap(w);
+    return w;
+}
+
+// Whether the first Size bytes at lhs and rhs are equal. Differences are accumulated without branching.
+template<std::size_t Size>
+inline auto equal(void const* lhs, void const* rhs) noexcept -> bool
+{
+    auto const*   l    = static_cast<unsigned char const*>(lhs);
+    auto const*   r    = static_cast<unsigned char const*>(rhs);
+    std::uint64_t diff = 0;
+    std::size_t   i    = 0;
+    for (; i + word_size <= Size; i += word_size)
+    {
+        std::uint64_t lw = 0;
+        std::uint64_t rw = 0;
+        std::memcpy(&lw, l + i, word_size);
+        std::memcpy(&rw, r + i, word_size);
+        diff |= lw ^ rw;
+    }
+    if constexpr (Size % word_size != 0)
+        diff |= load_big_endian<Size % word_size>(l + i) ^ load_big_endian<Size % word_size>(r + i);
+    return diff == 0;
+}
+
+// Three-way compares the first Size bytes at lhs and rhs as unsigned bytes, like memcmp
+template<std::size_t Size>
+inline auto compare(void const* lhs, void const* rhs) noexcept -> int
+{
+    auto const* l = static_cast<unsigned char const*>(lhs);
+    auto const* r = static_cast<unsigned char const*>(rhs);
+    std::size_t i = 0;
+    for (; i + word_size <= Size; i += word_size)
+    {
+        std::uint64_t const lw = load_big_endian(l + i);
+        std::uint64_t const rw = load_big_endian(r + i);
+        if (lw != rw)
+            return lw < rw ? -1 : 1;
+    }
+    if constexpr (Size % word_size != 0)
+    {
+        std::uint64_t const lw = load_big_endian<Size % word_size>(l + i);
+        std::uint64_t const rw = load_big_endian<Size % word_size>(r + i);
+        return (lw > rw) - (lw < rw);
+    }
+    return 0;
+}
+} // namespace structural::detail::word_compare
+
+#endif // STRUCTURAL_WORD_COMPARE_HPP
@@ -0,0 +1,259 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_HIERARCHICAL_BITSET_HPP
+#define STRUCTURAL_HIERARCHICAL_BITSET_HPP
+
+#include "structural/bitset.hpp"
+
+#include <ctrx/contracts.hpp>
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <ranges>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace structural
+{
+/// Fixed-size sequence of N bits for large, sparsely populated sets, usable as a non-type template parameter.
+///
+/// The bits are stored in 64-bit words, plus a summary bitset with one bit per word that is set iff the word is not
+/// zero. Queries like any(), find_first() and iteration over set bits consult the summary first and thus skip 4096
+/// unset bits per summary word.
+///
+/// # Notes
+///  - Unlike bitset, words[0] holds the least significant bits.
+///  - The summary is kept up to date by all members; modifying `words` directly requires the same of the caller.
+template<std::size_t N>
+    requires(N > 0)
+struct hierarchical_bitset
+{
+    using word_t = std::uint64_t;
+
+    static constexpr std::size_t bits_per_word = sizeof(word_t) * CHAR_BIT;
+    static constexpr std::size_t word_count    = 1 + (N - 1) / bits_per_word;
+    static constexpr std::size_t npos          = -1;
+
+    /// Forward iterator over the indices of the set bits, in ascending order
+    class set_bit_iterator
+    {
+    public:
+        using value_type      = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        constexpr set_bit_iterator() noexcept = default;
+        constexpr set_bit_iterator(hierarchical_bitset const& bs, std::size_t word) noexcept
+            : bs(&bs)
+            , word(word)
+        {
+            if (word < word_count)
+                remaining = bs.words[word];
+            skip_empty_words();
+        }
+
+        constexpr auto operator==(set_bit_iterator const&) const noexcept -> bool = default;
+
+        [[nodiscard]] constexpr auto operator*() const noexcept -> std::size_t
+        {
+            return word * bits_per_word + std::countr_zero(remaining);
+        }
+
+        constexpr auto operator++() noexcept -> set_bit_iterator&
+        {
+            remaining &= remaining - 1u;
+            skip_empty_words();
+            return *this;
+        }
+
+        constexpr auto operator++(int) noexcept -> set_bit_iterator
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+    private:
+        constexpr void skip_empty_words() noexcept
+        {
+            if (remaining != 0 || word >= word_count)
+                return;
+            word = bs->summary.find_next(word);
+            if (word == npos)
+                word = word_count;
+            else
+                remaining = bs->words[word];
+        }
+
+        hierarchical_bitset const* bs        = nullptr;
+        std::size_t                word      = 0;
+        word_t                     remaining = 0;
+    };
+
+    constexpr hierarchical_bitset() noexcept = default;
+    constexpr explicit hierarchical_bitset(bitset<N> const& bs) noexcept
+    {
+        bs.for_each_set([this](std::size_t pos) { set(pos); });
+    }
+
+    constexpr auto operator==(hierarchical_bitset const& rhs) const noexcept -> bool = default;
+
+    [[nodiscard]] static constexpr auto size() noexcept { return N; }
+
+    /// Converts to a flat bitset
+    [[nodiscard]] constexpr auto to_bitset() const noexcept -> bitset<N>
+    {
+        bitset<N> result;
+        for_each_set([&](std::size_t pos) { result.set(pos); });
+        return result;
+    }
+
+    [[nodiscard]] constexpr auto test(std::size_t pos) const noexcept -> bool
+    {
+        CTRX_PRECONDITION(pos < N);
+        return (words[pos / bits_per_word] >> (pos % bits_per_word)) & 1u;
+    }
+
+    [[nodiscard]] constexpr auto all() const noexcept -> bool
+    {
+        if (!summary.all())
+            return false;
+        for (std::size_t i = 0; i + 1 < word_count; ++i)
+            if (words[i] != ~word_t{0})
+                return false;
+        return words.back() == tail_mask;
+    }
+
+    [[nodiscard]] constexpr auto any() const noexcept -> bool { return summary.any(); }
+
+    [[nodiscard]] constexpr auto none() const noexcept -> bool { return summary.none(); }
+
+    [[nodiscard]] constexpr auto count() const noexcept -> std::size_t
+    {
+        std::size_t result = 0;
+        summary.for_each_set([&](std::size_t i) { result += std::popcount(words[i]); });
+        return result;
+    }
+
+    [[maybe_unused]] constexpr auto set() noexcept -> hierarchical_bitset&
+    {
+        words.fill(~word_t{0});
+        words.back() = tail_mask;
+        summary.set();
+        return *this;
+    }
+
+    [[maybe_unused]] constexpr auto set(std::size_t pos, bool value = true) noexcept -> hierarchical_bitset&
+    {
+        CTRX_PRECONDITION(pos < N);
+        auto const i = pos / bits_per_word;
+        auto const n = pos % bits_per_word;
+        words[i]     = (words[i] & ~(word_t{1} << n)) | (word_t{value} << n);
+        summary.set(i, words[i] != 0);
+        return *this;
+    }
+
+    [[maybe_unused]] constexpr auto reset() noexcept -> hierarchical_bitset&
+    {
+        summary.for_each_set([this](std::size_t i) { words[i] = 0; });
+        summary.reset();
+        return *this;
+    }
+
+    [[maybe_unused]] constexpr auto reset(std::size_t pos) noexcept -> hierarchical_bitset&
+    {
+        return set(pos, false);
+    }
+
+    [[maybe_unused]] constexpr auto flip(std::size_t pos) noexcept -> hierarchical_bitset&
+    {
+        return set(pos, !test(pos));
+    }
+
+    /// The index of the lowest set bit, or npos if there is none.
+    [[nodiscard]] constexpr auto find_first() const noexcept -> std::size_t
+    {
+        auto const i = summary.find_first();
+        if (i == npos)
+            return npos;
+        return i * bits_per_word + std::countr_zero(words[i]);
+    }
+
+    /// The index of the lowest set bit above pos, or npos if there is none.
+    [[nodiscard]] constexpr auto find_next(std::size_t pos) const noexcept -> std::size_t
+    {
+        if (pos >= N - 1)
+            return npos;
+        ++pos;
+        auto const i = pos / bits_per_word;
+        auto const w = words[i] & (~word_t{0} << (pos % bits_per_word));
+        if (w != 0)
+            return i * bits_per_word + std::countr_zero(w);
+        auto const next = summary.find_next(i);
+        if (next == npos)
+            return npos;
+        return next * bits_per_word + std::countr_zero(words[next]);
+    }
+
+    /// The index of the highest set bit, or npos if there is none.
+    [[nodiscard]] constexpr auto find_last() const noexcept -> std::size_t
+    {
+        auto const i = summary.find_last();
+        if (i == npos)
+            return npos;
+        return i * bits_per_word + bits_per_word - 1 - std::countl_zero(words[i]);
+    }
+
+    /// Range over the indices of the set bits, in ascending order
+    [[nodiscard]] constexpr auto set_bits() const noexcept -> std::ranges::subrange<set_bit_iterator>
+    {
+        return {set_bit_iterator{*this, 0}, set_bit_iterator{*this, word_count}};
+    }
+
+    /// Calls fn(i) for the index i of each set bit, in ascending order
+    template<typename Fn>
+        requires std::invocable<Fn&, std::size_t>
+    constexpr void for_each_set(Fn fn) const
+    {
+        summary.for_each_set(
+            [&](std::size_t i)
+            {
+                for (word_t w = words[i]; w != 0; w &= w - 1u)
+                    std::invoke(fn, i * bits_per_word + std::countr_zero(w));
+            });
+    }
+
+    std::array<word_t, word_count> words{};
+    bitset<word_count>             summary{};
+
+private:
+    static constexpr word_t tail_mask = detail::tail_mask<N, word_t>;
+};
+} // namespace structural
+
+#endif // STRUCTURAL_HIERARCHICAL_BITSET_HPP
@@ -0,0 +1,327 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_INPLACE_BITMAP_SET_HPP
+#define STRUCTURAL_INPLACE_BITMAP_SET_HPP
+
+#include "structural/bitset.hpp"
+#include "structural/detail/bitset_kernels.hpp"
+#include "structural/pair.hpp"
+
+#include <ctrx/contracts.hpp>
+
+#include <concepts>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+#include <cstddef>
+
+namespace structural
+{
+/// A set of the integers in [0, MaxValue], stored as a bitset with one bit per value
+///
+/// Provides the interface of inplace_set. Insertion, erasure and lookup are O(1); iteration, size() and the set
+/// operations work on whole words of the bitset.
+///
+/// # Notes
+///  - The set occupies (MaxValue + 1) / 8 bytes regardless of its size, which makes it a good fit for dense sets over a
+///    small universe, e.g. port numbers or shard ids.
+///  - Iterators yield the values by copy, so dereferencing them doesn't return a reference.
+template<std::integral Key, std::size_t MaxValue>
+struct inplace_bitmap_set
+{
+    using key_type        = Key;
+    using value_type      = Key;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using key_compare     = std::less<Key>;
+    using value_compare   = std::less<Key>;
+    using reference       = value_type;
+    using const_reference = value_type;
+
+    /// Bidirectional iterator over the values of the set, in ascending order
+    class const_iterator
+    {
+    public:
+        using iterator_concept  = std::bidirectional_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = Key;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = Key;
+
+        constexpr const_iterator() noexcept = default;
+
+        [[nodiscard]] constexpr auto operator*() const noexcept -> Key
+        {
+            CTRX_PRECONDITION(pos != npos);
+            return static_cast<Key>(pos);
+        }
+
+        constexpr auto operator++() noexcept -> const_iterator&
+        {
+            CTRX_PRECONDITION(pos != npos);
+            pos = set->bits.find_next(pos);
+            return *this;
+        }
+        constexpr auto operator++(int) noexcept -> const_iterator
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+        constexpr auto operator--() noexcept -> const_iterator&
+        {
+            pos = set->bits.find_prev(pos == npos ? MaxValue + 1 : pos);
+            CTRX_ASSERT(pos != npos);
+            return *this;
+        }
+        constexpr auto operator--(int) noexcept -> const_iterator
+        {
+            auto copy = *this;
+            --*this;
+            return copy;
+        }
+
+        friend constexpr auto operator==(const_iterator const& lhs, const_iterator const& rhs) noexcept -> bool
+        {
+            return lhs.pos == rhs.pos;
+        }
+
+    private:
+        friend struct inplace_bitmap_set;
+
+        constexpr const_iterator(inplace_bitmap_set const& set, std::size_t pos) noexcept
+            : set(&set)
+            , pos(pos)
+        {
+        }
+
+        inplace_bitmap_set const* set = nullptr;
+        std::size_t               pos = npos;
+    };
+    using iterator               = const_iterator;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    constexpr inplace_bitmap_set() noexcept = default;
+    template<std::input_iterator First, std::sentinel_for<First> Last>
+    constexpr inplace_bitmap_set(First first, Last last)
+    {
+        insert(first, last);
+    }
+    constexpr inplace_bitmap_set(std::initializer_list<value_type> init) { insert(init); }
+    constexpr auto operator=(std::initializer_list<value_type> init) -> inplace_bitmap_set&
+    {
+        clear();
+        insert(init);
+        return *this;
+    }
+
+    constexpr auto begin() const noexcept -> const_iterator { return {*this, bits.find_first()}; }
+    constexpr auto cbegin() const noexcept -> const_iterator { return begin(); }
+    constexpr auto end() const noexcept -> const_iterator { return {*this, npos}; }
+    constexpr auto cend() const noexcept -> const_iterator { return end(); }
+    constexpr auto rbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator{end()}; }
+    constexpr auto crbegin() const noexcept -> const_reverse_iterator { return rbegin(); }
+    constexpr auto rend() const noexcept -> const_reverse_iterator { return const_reverse_iterator{begin()}; }
+    constexpr auto crend() const noexcept -> const_reverse_iterator { return rend(); }
+
+    [[nodiscard]] constexpr auto        empty() const noexcept -> bool { return bits.none(); }
+    [[nodiscard]] constexpr auto        size() const noexcept -> size_type { return bits.count(); }
+    [[nodiscard]] constexpr static auto capacity() noexcept -> size_type { return MaxValue + 1; }
+
+    constexpr void clear() noexcept { bits.reset(); }
+
+    /// Inserts value, returning an iterator to it
+    ///
+    /// # Requires
+    /// 0 <= value <= MaxValue
+    constexpr auto insert(value_type value) noexcept -> const_iterator
+    {
+        CTRX_PRECONDITION(in_range(value));
+        bits.set(static_cast<std::size_t>(value));
+        return {*this, static_cast<std::size_t>(value)};
+    }
+    template<std::input_iterator First, std::sentinel_for<First> Last>
+    constexpr void insert(First first, Last last)
+    {
+        for (auto iter = first; iter != last; ++iter)
+            insert(*iter);
+    }
+    constexpr void insert(std::initializer_list<value_type> init) { insert(init.begin(), init.end()); }
+
+    template<typename... Args>
+    constexpr auto emplace(Args&&... args) -> const_iterator
+    {
+        return insert(value_type(std::forward<Args>(args)...));
+    }
+
+    constexpr auto erase(const_iterator pos) noexcept -> const_iterator
+    {
+        CTRX_PRECONDITION(pos.pos != npos);
+        bits.reset(pos.pos);
+        return {*this, bits.find_next(pos.pos)};
+    }
+    constexpr auto erase(const_iterator first, const_iterator last) noexcept -> const_iterator
+    {
+        for (auto iter = first; iter != last;)
+            iter = erase(iter);
+        return last;
+    }
+    constexpr auto erase(value_type value) noexcept -> size_type
+    {
+        if (!contains(value))
+            return 0;
+        bits.reset(static_cast<std::size_t>(value));
+        return 1;
+    }
+
+    [[nodiscard]] constexpr auto count(value_type value) const noexcept -> size_type { return contains(value) ? 1 : 0; }
+    [[nodiscard]] constexpr auto find(value_type value) const noexcept -> const_iterator
+    {
+        if (!contains(value))
+            return end();
+        return {*this, static_cast<std::size_t>(value)};
+    }
+    [[nodiscard]] constexpr auto contains(value_type value) const noexcept -> bool
+    {
+        return in_range(value) && bits.test(static_cast<std::size_t>(value));
+    }
+
+    [[nodiscard]] constexpr auto equal_range(value_type value) const noexcept -> pair<const_iterator, const_iterator>
+    {
+        return {lower_bound(value), upper_bound(value)};
+    }
+    /// Returns an iterator to the first element not less than value
+    [[nodiscard]] constexpr auto lower_bound(value_type value) const noexcept -> const_iterator
+    {
+        if (std::cmp_less_equal(value, 0))
+            return begin();
+        return upper_bound(static_cast<value_type>(value - 1));
+    }
+    /// Returns an iterator to the first element greater than value
+    [[nodiscard]] constexpr auto upper_bound(value_type value) const noexcept -> const_iterator
+    {
+        if (std::cmp_less(value, 0))
+            return begin();
+        if (std::cmp_greater_equal(value, MaxValue))
+            return end();
+        return {*this, bits.find_next(static_cast<std::size_t>(value))};
+    }
+
+    /// Union
+    constexpr auto operator|=(inplace_bitmap_set const& rhs) noexcept -> inplace_bitmap_set&
+    {
+        bits |= rhs.bits;
+        return *this;
+    }
+    /// Intersection
+    constexpr auto operator&=(inplace_bitmap_set const& rhs) noexcept -> inplace_bitmap_set&
+    {
+        bits &= rhs.bits;
+        return *this;
+    }
+    /// Difference
+    constexpr auto operator-=(inplace_bitmap_set const& rhs) noexcept -> inplace_bitmap_set&
+    {
+        using namespace detail::bitset_kernels;
+        binary<op::and_not_>(bits.chunks.data(), rhs.bits.chunks.data(), bits.chunks.size());
+        return *this;
+    }
+    /// Symmetric difference
+    constexpr auto operator^=(inplace_bitmap_set const& rhs) noexcept -> inplace_bitmap_set&
+    {
+        bits ^= rhs.bits;
+        return *this;
+    }
+
+    friend constexpr auto operator==(inplace_bitmap_set const& lhs, inplace_bitmap_set const& rhs) -> bool = default;
+
+    // -- internal API
+
+    static constexpr std::size_t npos = bitset<MaxValue + 1>::npos;
+
+    static constexpr auto in_range(value_type value) noexcept -> bool
+    {
+        return std::cmp_greater_equal(value, 0) && std::cmp_less_equal(value, MaxValue);
+    }
+
+    bitset<MaxValue + 1> bits;
+};
+
+template<std::integral Key, std::size_t MaxValue>
+constexpr auto operator|(inplace_bitmap_set<Key, MaxValue> const& lhs,
+                         inplace_bitmap_set<Key, MaxValue> const& rhs) noexcept -> inplace_bitmap_set<Key, MaxValue>
+{
+    auto copy = lhs;
+    copy |= rhs;
+    return copy;
+}
+
+template<std::integral Key, std::size_t MaxValue>
+constexpr auto operator&(inplace_bitmap_set<Key, MaxValue> const& lhs,
+                         inplace_bitmap_set<Key, MaxValue> const& rhs) noexcept -> inplace_bitmap_set<Key, MaxValue>
+{
+    auto copy = lhs;
+    copy &= rhs;
+    return copy;
+}
+
+template<std::integral Key, std::size_t MaxValue>
+constexpr auto operator-(inplace_bitmap_set<Key, MaxValue> const& lhs,
+                         inplace_bitmap_set<Key, MaxValue> const& rhs) noexcept -> inplace_bitmap_set<Key, MaxValue>
+{
+    auto copy = lhs;
+    copy -= rhs;
+    return copy;
+}
+
+template<std::integral Key, std::size_t MaxValue>
+constexpr auto operator^(inplace_bitmap_set<Key, MaxValue> const& lhs,
+                         inplace_bitmap_set<Key, MaxValue> const& rhs) noexcept -> inplace_bitmap_set<Key, MaxValue>
+{
+    auto copy = lhs;
+    copy ^= rhs;
+    return copy;
+}
+
+template<std::integral Key, std::size_t MaxValue, typename Pred>
+constexpr auto erase_if(inplace_bitmap_set<Key, MaxValue>& c, Pred pred) ->
+    typename inplace_bitmap_set<Key, MaxValue>::size_type
+{
+    auto old_size = c.size();
+    for (auto i = c.begin(), last = c.end(); i != last;)
+    {
+        if (pred(*i))
+            i = c.erase(i);
+        else
+            ++i;
+    }
+    return old_size - c.size();
+}
+} // namespace structural
+
+#endif // STRUCTURAL_INPLACE_BITMAP_SET_HPP
@@ -0,0 +1,275 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_INPLACE_BLOOM_FILTER_HPP
+#define STRUCTURAL_INPLACE_BLOOM_FILTER_HPP
+
+#include "structural/bitset.hpp"
+#include "structural/detail/bloom_kernels.hpp"
+#include "structural/hash.hpp"
+
+#include <initializer_list>
+#include <iterator>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace structural
+{
+namespace detail
+{
+constexpr auto pow(double base, std::size_t exp) noexcept -> double
+{
+    double result = 1;
+    for (; exp != 0; exp /= 2, base *= base)
+        if (exp % 2 != 0)
+            result *= base;
+    return result;
+}
+} // namespace detail
+
+/// Expected false positive rate of a Bloom filter with `bits` bits and k probes per key after inserting n keys
+[[nodiscard]] constexpr auto bloom_false_positive_rate(std::size_t bits, std::size_t k, std::size_t n) noexcept
+    -> double
+{
+    return detail::pow(1 - detail::pow(1 - 1.0 / double(bits), k * n), k);
+}
+
+/// Expected false positive rate of a blocked Bloom filter with `blocks` blocks and k probes per key after inserting n
+/// keys
+///
+/// # Notes
+/// Keys are distributed over the blocks binomially, and a block that holds i keys answers falsely with probability
+/// (1 - (31/32)^i)^k. The rate is higher than that of a plain Bloom filter of the same size, as some blocks fill up
+/// more than others.
+[[nodiscard]] constexpr auto blocked_bloom_false_positive_rate(std::size_t blocks,
+                                                              std::size_t k,
+                                                              std::size_t n) noexcept -> double
+{
+    auto const block_rate = [&](std::size_t keys) { return detail::pow(1 - detail::pow(31.0 / 32.0, keys), k); };
+    if (blocks == 1)
+        return block_rate(n);
+
+    // Summing the binomial distribution outwards from its mode, with weights relative to the mode, avoids underflow
+    double const      p          = 1.0 / double(blocks);
+    double const      odds       = p / (1 - p);
+    std::size_t const mode       = static_cast<std::size_t>(double(n) * p);
+    double            weight_sum = 1;
+    double            rate_sum   = block_rate(mode);
+    double            weight     = 1;
+    for (std::size_t i = mode; i < n && weight > 1e-18; ++i)
+    {
+        weight *= double(n - i) / double(i + 1) * odds;
+        weight_sum += weight;
+        rate_sum += weight * block_rate(i + 1);
+    }
+    weight = 1;
+    for (std::size_t i = mode; i > 0 && weight > 1e-18; --i)
+    {
+        weight *= double(i) / double(n - i + 1) / odds;
+        weight_sum += weight;
+        rate_sum += weight * block_rate(i - 1);
+    }
+    return rate_sum / weight_sum;
+}
+
+/// A Bloom filter over Bits bits, which tells whether a key may have been inserted
+///
+/// Each key sets K bits, derived from one call to Hash by double hashing. might_contain() is true for every inserted
+/// key, and true for any other key with probability false_positive_rate(n) after n insertions.
+///
+/// # Notes
+/// The filter is structural and constexpr: a filter for keys known at compile time can be built in a constant
+/// expression and passed as template argument.
+template<typename Key, std::size_t Bits, std::size_t K, typename Hash = hash<Key>>
+struct inplace_bloom_filter
+{
+    static_assert(Bits > 0 && K > 0);
+
+    using key_type  = Key;
+    using hasher    = Hash;
+    using size_type = std::size_t;
+
+    constexpr inplace_bloom_filter() noexcept = default;
+    template<std::input_iterator First, std::sentinel_for<First> Last>
+    constexpr inplace_bloom_filter(First first, Last last)
+    {
+        insert(first, last);
+    }
+    constexpr inplace_bloom_filter(std::initializer_list<Key> init) { insert(init); }
+
+    constexpr void insert(Key const& key)
+    {
+        for_each_probe(key,
+                       [&](std::size_t bit)
+                       {
+                           bits.set(bit);
+                           return true;
+                       });
+    }
+    template<std::input_iterator First, std::sentinel_for<First> Last>
+    constexpr void insert(First first, Last last)
+    {
+        for (auto iter = first; iter != last; ++iter)
+            insert(*iter);
+    }
+    constexpr void insert(std::initializer_list<Key> init) { insert(init.begin(), init.end()); }
+
+    /// Returns false if key was definitely not inserted
+    [[nodiscard]] constexpr auto might_contain(Key const& key) const -> bool
+    {
+        return for_each_probe(key, [&](std::size_t bit) { return bits.test(bit); });
+    }
+
+    constexpr void clear() noexcept { bits.reset(); }
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool { return bits.none(); }
+
+    /// Expected false positive rate after inserting n distinct keys
+    [[nodiscard]] static constexpr auto false_positive_rate(size_type n) noexcept -> double
+    {
+        return bloom_false_positive_rate(Bits, K, n);
+    }
+
+    /// Adds the keys of rhs, as if they had been inserted into this filter
+    constexpr auto operator|=(inplace_bloom_filter const& rhs) noexcept -> inplace_bloom_filter&
+    {
+        bits |= rhs.bits;
+        return *this;
+    }
+
+    friend constexpr auto operator==(inplace_bloom_filter const&, inplace_bloom_filter const&) -> bool = default;
+
+    // -- internal API
+
+    // Calls fn with the K bit indices of key until it returns false. Returns whether it never did.
+    template<typename Fn>
+    static constexpr auto for_each_probe(Key const& key, Fn fn) -> bool
+    {
+        std::uint64_t const h    = detail::bloom_kernels::mix(Hash{}(key));
+        std::size_t         bit  = static_cast<std::size_t>(h % Bits);
+        std::size_t const   step = static_cast<std::size_t>(((h >> 32) | (h << 32)) % Bits);
+        for (std::size_t i = 0; i < K; ++i)
+        {
+            if (!fn(bit))
+                return false;
+            bit += step == 0 ? 1 : step;
+            if (bit >= Bits)
+                bit -= Bits;
+        }
+        return true;
+    }
+
+    bitset<Bits> bits;
+};
+
+/// A Bloom filter whose probes for one key all land in the same 256-bit block of its Bits bits
+///
+/// A key sets one bit in each of K 32-bit words of its block. Probing touches a single cache line and, with AVX2, takes
+/// a handful of vector instructions, at the cost of a somewhat higher false positive rate than inplace_bloom_filter of
+/// the same size.
+///
+/// # Requires
+///  - Bits is a multiple of 256
+///  - 1 <= K <= 8
+///
+/// # Notes
+/// Like inplace_bloom_filter, the filter is structural and constexpr. Filters built at compile time and at run time
+/// are identical.
+template<typename Key, std::size_t Bits, std::size_t K = 8, typename Hash = hash<Key>>
+struct inplace_blocked_bloom_filter
+{
+    static_assert(Bits > 0 && Bits % detail::bloom_kernels::block_bits == 0);
+    static_assert(K >= 1 && K <= detail::bloom_kernels::block_words);
+
+    using key_type  = Key;
+    using hasher    = Hash;
+    using size_type = std::size_t;
+
+    static constexpr size_type block_count = Bits / detail::bloom_kernels::block_bits;
+
+    constexpr inplace_blocked_bloom_filter() noexcept = default;
+    template<std::input_iterator First, std::sentinel_for<First> Last>
+    constexpr inplace_blocked_bloom_filter(First first, Last last)
+    {
+        insert(first, last);
+    }
+    constexpr inplace_blocked_bloom_filter(std::initializer_list<Key> init) { insert(init); }
+
+    constexpr void insert(Key const& key)
+    {
+        std::uint64_t const h = detail::bloom_kernels::mix(Hash{}(key));
+        detail::bloom_kernels::insert<K>(block(h), static_cast<std::uint32_t>(h));
+    }
+    template<std::input_iterator First, std::sentinel_for<First> Last>
+    constexpr void insert(First first, Last last)
+    {
+        for (auto iter = first; iter != last; ++iter)
+            insert(*iter);
+    }
+    constexpr void insert(std::initializer_list<Key> init) { insert(init.begin(), init.end()); }
+
+    /// Returns false if key was definitely not inserted
+    [[nodiscard]] constexpr auto might_contain(Key const& key) const -> bool
+    {
+        std::uint64_t const h = detail::bloom_kernels::mix(Hash{}(key));
+        return detail::bloom_kernels::contains<K>(block(h), static_cast<std::uint32_t>(h));
+    }
+
+    constexpr void clear() noexcept { bits.reset(); }
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool { return bits.none(); }
+
+    /// Expected false positive rate after inserting n distinct keys
+    [[nodiscard]] static constexpr auto false_positive_rate(size_type n) noexcept -> double
+    {
+        return blocked_bloom_false_positive_rate(block_count, K, n);
+    }
+
+    /// Adds the keys of rhs, as if they had been inserted into this filter
+    constexpr auto operator|=(inplace_blocked_bloom_filter const& rhs) noexcept -> inplace_blocked_bloom_filter&
+    {
+        bits |= rhs.bits;
+        return *this;
+    }
+
+    friend constexpr auto operator==(inplace_blocked_bloom_filter const&, inplace_blocked_bloom_filter const&)
+        -> bool = default;
+
+    // -- internal API
+
+    // The upper half of the hash picks the block, the lower half the bits within it
+    constexpr auto block(std::uint64_t h) noexcept -> std::uint64_t*
+    {
+        return bits.chunks.data() + ((h >> 32) * block_count >> 32) * detail::bloom_kernels::block_chunks;
+    }
+    constexpr auto block(std::uint64_t h) const noexcept -> std::uint64_t const*
+    {
+        return bits.chunks.data() + ((h >> 32) * block_count >> 32) * detail::bloom_kernels::block_chunks;
+    }
+
+    // Aligned so that no block straddles two cache lines
+    alignas(64) bitset<Bits, std::uint64_t> bits;
+};
+} // namespace structural
+
+#endif // STRUCTURAL_INPLACE_BLOOM_FILTER_HPP
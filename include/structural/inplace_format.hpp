@@ -0,0 +1,257 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_INPLACE_FORMAT_HPP
+#define STRUCTURAL_INPLACE_FORMAT_HPP
+
+#include "structural/basic_inplace_string.hpp"
+#include "structural/detail/to_chars.hpp"
+#include "structural/inplace_string.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <string_view>
+#include <type_traits>
+
+#include <cstddef>
+
+namespace structural
+{
+/// The maximum number of characters append_int() or append_float() can produce for a value of type T
+template<typename T>
+    requires(detail::formattable_integer<T> || detail::formattable_floating_point<T>)
+inline constexpr std::size_t max_formatted_size = detail::max_chars<T>;
+
+namespace detail
+{
+// Runs writer(char*) -> char* on the tail of str. Writes directly into the string if the worst case fits, and goes
+// through a local buffer otherwise.
+template<std::size_t MaxChars, typename CharT, std::size_t Capacity, typename Traits, typename Writer>
+constexpr void append_formatted(basic_inplace_string<CharT, Capacity, Traits>& str, Writer writer)
+{
+    auto const old_size = str.size();
+    if constexpr (std::same_as<CharT, char>)
+    {
+        if (Capacity - old_size >= MaxChars)
+        {
+            str.resize_and_overwrite(old_size + MaxChars,
+                                     [&](char* p, std::size_t) { return writer(p + old_size) - p; });
+            return;
+        }
+    }
+    std::array<char, MaxChars> buffer{};
+    auto const                 length = static_cast<std::size_t>(writer(buffer.data()) - buffer.data());
+    str.resize_and_overwrite(old_size + length,
+                             [&](CharT* p, std::size_t)
+                             { return std::copy_n(buffer.begin(), length, p + old_size) - p; });
+}
+} // namespace detail
+
+/// Appends the decimal representation of `value` to `str`
+///
+/// # Requires
+/// The result must fit into `str`. Reserving `max_formatted_size<T>` characters is always enough.
+///
+/// # Notes
+/// - Doesn't invalidate any iterators, references or pointers into `str`.
+/// - The output matches `std::to_chars(first, last, value)`.
+template<typename CharT, std::size_t Capacity, typename Traits, detail::formattable_integer T>
+constexpr auto append_int(basic_inplace_string<CharT, Capacity, Traits>& str, T value)
+    -> basic_inplace_string<CharT, Capacity, Traits>&
+{
+    detail::append_formatted<detail::max_chars<T>>(str, [value](char* p) { return detail::write_integer(p, value); });
+    return str;
+}
+
+/// Appends the shortest representation of `value` that round-trips to `str`
+///
+/// # Requires
+/// The result must fit into `str`. Reserving `max_formatted_size<T>` characters is always enough.
+///
+/// # Notes
+/// - Doesn't invalidate any iterators, references or pointers into `str`.
+/// - The output matches `std::to_chars(first, last, value)`. At run time, that is what's used; in constant
+///   expressions an exact but much slower algorithm takes its place.
+template<typename CharT, std::size_t Capacity, typename Traits, detail::formattable_floating_point T>
+constexpr auto append_float(basic_inplace_string<CharT, Capacity, Traits>& str, T value)
+    -> basic_inplace_string<CharT, Capacity, Traits>&
+{
+    detail::append_formatted<detail::max_chars<T>>(str,
+                                                   [value](char* p) { return detail::write_floating_point(p, value); });
+    return str;
+}
+
+/// Returns the representation of `value` as produced by append_int() or append_float()
+///
+/// # Requires
+/// The result must fit into `Capacity` characters.
+template<std::size_t Capacity, typename T>
+    requires(detail::formattable_integer<T> || detail::formattable_floating_point<T>)
+constexpr auto to_inplace_string(T value) -> inplace_string<Capacity>
+{
+    inplace_string<Capacity> result;
+    if constexpr (detail::formattable_integer<T>)
+        append_int(result, value);
+    else
+        append_float(result, value);
+    return result;
+}
+
+/// Equivalent to to_inplace_string<max_formatted_size<T>>(value)
+template<typename T>
+    requires(detail::formattable_integer<T> || detail::formattable_floating_point<T>)
+constexpr auto to_inplace_string(T value) -> inplace_string<max_formatted_size<T>>
+{
+    return to_inplace_string<max_formatted_size<T>>(value);
+}
+
+namespace detail
+{
+// Deliberately not constexpr: calling these from the consteval format string constructor makes the error show up at
+// compile time, with the function name as message.
+void inplace_format_string_has_wrong_number_of_arguments();
+void inplace_format_string_has_unmatched_brace();
+void inplace_format_string_has_unsupported_format_spec();
+
+template<typename T>
+concept inplace_formattable = formattable_integer<T> || formattable_floating_point<T> || std::same_as<T, bool>
+                              || std::same_as<T, char> || std::convertible_to<T const&, std::string_view>;
+
+template<std::size_t Capacity, typename Traits, typename T>
+constexpr void append_format_arg(basic_inplace_string<char, Capacity, Traits>& str, T const& arg)
+{
+    if constexpr (std::same_as<T, bool>)
+        str.append(arg ? "true" : "false");
+    else if constexpr (std::same_as<T, char>)
+        str.push_back(arg);
+    else if constexpr (formattable_integer<T>)
+        append_int(str, arg);
+    else if constexpr (formattable_floating_point<T>)
+        append_float(str, arg);
+    else
+        str.append(std::string_view(arg));
+}
+} // namespace detail
+
+/// A format string for inplace_format() and append_format(), checked at compile time
+///
+/// Supports `{}` as placeholder for the next argument, and `{{` and `}}` as escaped braces. Format specs and explicit
+/// argument indices aren't supported.
+template<typename... Args>
+struct basic_inplace_format_string
+{
+    template<typename S>
+        requires std::convertible_to<S const&, std::string_view>
+    consteval basic_inplace_format_string(S const& s)
+        : str(s)
+    {
+        std::size_t placeholders = 0;
+        for (std::size_t i = 0; i < str.size(); ++i)
+        {
+            if (str[i] == '{')
+            {
+                if (i + 1 < str.size() && str[i + 1] == '{')
+                    ++i;
+                else if (i + 1 < str.size() && str[i + 1] == '}')
+                {
+                    ++i;
+                    ++placeholders;
+                }
+                else
+                    detail::inplace_format_string_has_unsupported_format_spec();
+            }
+            else if (str[i] == '}')
+            {
+                if (i + 1 < str.size() && str[i + 1] == '}')
+                    ++i;
+                else
+                    detail::inplace_format_string_has_unmatched_brace();
+            }
+        }
+        if (placeholders != sizeof...(Args))
+            detail::inplace_format_string_has_wrong_number_of_arguments();
+    }
+
+    std::string_view str;
+};
+
+template<typename... Args>
+using inplace_format_string = basic_inplace_format_string<std::type_identity_t<Args>...>;
+
+/// Appends `fmt` to `str`, with each `{}` replaced by the next argument
+///
+/// Integers and floating point values are formatted like append_int() and append_float(), bool as `true` or
+/// `false`, and characters and strings as they are.
+///
+/// # Requires
+/// The result must fit into `str`.
+///
+/// # Notes
+/// Doesn't invalidate any iterators, references or pointers into `str`.
+template<std::size_t Capacity, typename Traits, detail::inplace_formattable... Args>
+constexpr auto append_format(basic_inplace_string<char, Capacity, Traits>& str,
+                             inplace_format_string<Args...>                fmt,
+                             Args const&... args) -> basic_inplace_string<char, Capacity, Traits>&
+{
+    std::string_view rest = fmt.str;
+    auto const append_literal = [&]
+    {
+        // Copies up to the next placeholder, unescaping braces on the way
+        while (!rest.empty())
+        {
+            auto const brace = std::min(rest.find('{'), rest.find('}'));
+            str.append(rest.substr(0, brace));
+            if (brace == std::string_view::npos)
+            {
+                rest = {};
+                return;
+            }
+            bool const placeholder = rest[brace] == '{' && rest[brace + 1] == '}';
+            if (!placeholder)
+                str.push_back(rest[brace]);
+            rest.remove_prefix(brace + 2);
+            if (placeholder)
+                return;
+        }
+    };
+    ((append_literal(), detail::append_format_arg(str, args)), ...);
+    append_literal();
+    return str;
+}
+
+/// Returns `fmt`, with each `{}` replaced by the next argument, as formatted by append_format()
+///
+/// # Requires
+/// The result must fit into `Capacity` characters.
+template<std::size_t Capacity, detail::inplace_formattable... Args>
+constexpr auto inplace_format(inplace_format_string<Args...> fmt, Args const&... args) -> inplace_string<Capacity>
+{
+    inplace_string<Capacity> result;
+    append_format(result, fmt, args...);
+    return result;
+}
+} // namespace structural
+
+#endif // STRUCTURAL_INPLACE_FORMAT_HPP
@@ -184,8 +184,8 @@ struct inplace_map
     constexpr auto try_emplace(Key const& key, Args&&... args) -> pair<iterator, bool>
     {
         auto const new_node_idx = data.allocate_node(std::piecewise_construct,
-                                                     forward_as_tuple(key),
-                                                     forward_as_tuple(std::forward<Args>(args)...));
+                                                     structural::forward_as_tuple(key),
+                                                     structural::forward_as_tuple(std::forward<Args>(args)...));
         auto       overwrite_fn = [&](auto&&...)
         {
             data.deallocate_node(new_node_idx);
@@ -196,14 +196,14 @@ struct inplace_map
         };
         bool preexisting = false;
         auto iter = data.insert(data.nodes[new_node_idx].active.payload, &preexisting, overwrite_fn, allocate_fn);
-        return make_pair(iter, preexisting);
+        return structural::make_pair(iter, preexisting);
     }
     template<typename... Args>
     constexpr auto try_emplace(Key&& key, Args&&... args) -> pair<iterator, bool>
     {
         auto const new_node_idx = data.allocate_node(std::piecewise_construct,
-                                                     forward_as_tuple(std::move(key)),
-                                                     forward_as_tuple(std::forward<Args>(args)...));
+                                                     structural::forward_as_tuple(std::move(key)),
+                                                     structural::forward_as_tuple(std::forward<Args>(args)...));
         auto       overwrite_fn = [&](auto&&...)
         {
             data.deallocate_node(new_node_idx);
@@ -214,7 +214,7 @@ struct inplace_map
         };
         bool preexisting = false;
         auto iter = data.insert(data.nodes[new_node_idx].active.payload, &preexisting, overwrite_fn, allocate_fn);
-        return make_pair(iter, preexisting);
+        return structural::make_pair(iter, preexisting);
     }
 
     constexpr auto erase(const_iterator pos) -> iterator { return data.erase(*pos); }
@@ -0,0 +1,398 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_INPLACE_RING_BUFFER_HPP
+#define STRUCTURAL_INPLACE_RING_BUFFER_HPP
+
+#include "structural/pair.hpp"
+#include "structural/uninitialized_array.hpp"
+
+#include <ctrx/contracts.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include <cstddef>
+
+namespace structural
+{
+template<typename T, std::size_t Capacity>
+struct inplace_ring_buffer;
+
+namespace detail
+{
+template<typename T, std::size_t Capacity, bool Const>
+struct inplace_ring_buffer_iterator
+{
+    using iterator_concept  = std::random_access_iterator_tag;
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = std::conditional_t<Const, value_type const*, value_type*>;
+    using reference         = std::conditional_t<Const, value_type const&, value_type&>;
+
+    using container_ptr = std::conditional_t<Const,
+                                             inplace_ring_buffer<T, Capacity> const*,
+                                             inplace_ring_buffer<T, Capacity>*>;
+
+    constexpr inplace_ring_buffer_iterator() = default;
+
+    constexpr inplace_ring_buffer_iterator(container_ptr container, difference_type idx)
+        : container(container)
+        , idx(idx)
+    {
+    }
+
+    template<bool IsConst = Const>
+        requires(IsConst)
+    constexpr inplace_ring_buffer_iterator(inplace_ring_buffer_iterator<T, Capacity, false> const& rhs)
+        : container(rhs.container)
+        , idx(rhs.idx)
+    {
+    }
+
+    constexpr inplace_ring_buffer_iterator(inplace_ring_buffer_iterator const&) = default;
+
+    constexpr auto operator=(inplace_ring_buffer_iterator const&) -> inplace_ring_buffer_iterator& = default;
+
+    constexpr auto operator==(inplace_ring_buffer_iterator const& rhs) const -> bool { return idx == rhs.idx; }
+    constexpr auto operator<=>(inplace_ring_buffer_iterator const& rhs) const { return idx <=> rhs.idx; }
+
+    constexpr auto operator*() const -> reference { return (*container)[idx]; }
+    constexpr auto operator->() const -> pointer { return &**this; }
+
+    constexpr auto operator++() -> inplace_ring_buffer_iterator&
+    {
+        ++idx;
+        return *this;
+    }
+    constexpr auto operator++(int) -> inplace_ring_buffer_iterator
+    {
+        auto copy = *this;
+        ++(*this);
+        return copy;
+    }
+
+    constexpr auto operator+=(difference_type n) -> inplace_ring_buffer_iterator&
+    {
+        idx += n;
+        return *this;
+    }
+
+    friend constexpr auto operator+(inplace_ring_buffer_iterator iter, difference_type n)
+        -> inplace_ring_buffer_iterator
+    {
+        return iter += n;
+    }
+    friend constexpr auto operator+(difference_type n, inplace_ring_buffer_iterator iter)
+        -> inplace_ring_buffer_iterator
+    {
+        return iter += n;
+    }
+
+    constexpr auto operator--() -> inplace_ring_buffer_iterator&
+    {
+        --idx;
+        return *this;
+    }
+    constexpr auto operator--(int) -> inplace_ring_buffer_iterator
+    {
+        auto copy = *this;
+        --(*this);
+        return copy;
+    }
+
+    constexpr auto operator-=(difference_type n) -> inplace_ring_buffer_iterator&
+    {
+        idx -= n;
+        return *this;
+    }
+
+    constexpr auto operator-(inplace_ring_buffer_iterator const& rhs) const -> difference_type
+    {
+        return idx - rhs.idx;
+    }
+    friend constexpr auto operator-(inplace_ring_buffer_iterator iter, difference_type n)
+        -> inplace_ring_buffer_iterator
+    {
+        return iter -= n;
+    }
+
+    constexpr auto operator[](difference_type n) const -> reference { return *(*this + n); }
+
+    container_ptr   container = nullptr;
+    difference_type idx       = 0;
+};
+} // namespace detail
+
+/// Fixed-capacity double-ended queue storing its elements in a circular buffer.
+///
+/// # Notes
+/// All elements are stored within the object, no dynamic memory is allocated. Insertion and removal at either end is
+/// O(1). If `Capacity` is a power of two, wrapping indices is a single mask operation.
+template<typename T, std::size_t Capacity>
+struct inplace_ring_buffer
+{
+    using value_type             = uninitialized_array<T, Capacity>::value_type;
+    using size_type              = uninitialized_array<T, Capacity>::size_type;
+    using difference_type        = uninitialized_array<T, Capacity>::difference_type;
+    using reference              = uninitialized_array<T, Capacity>::reference;
+    using const_reference        = uninitialized_array<T, Capacity>::const_reference;
+    using pointer                = uninitialized_array<T, Capacity>::pointer;
+    using const_pointer          = uninitialized_array<T, Capacity>::const_pointer;
+    using iterator               = detail::inplace_ring_buffer_iterator<T, Capacity, false>;
+    using const_iterator         = detail::inplace_ring_buffer_iterator<T, Capacity, true>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    constexpr ~inplace_ring_buffer() { clear(); }
+
+    constexpr inplace_ring_buffer() = default;
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sentinel>
+    constexpr inplace_ring_buffer(Iter begin, Sentinel end)
+    {
+        for (auto iter = begin; iter != end; ++iter)
+            push_back(*iter);
+    }
+    constexpr inplace_ring_buffer(std::initializer_list<T> init)
+        : inplace_ring_buffer(init.begin(), init.end())
+    {
+    }
+
+    constexpr inplace_ring_buffer(inplace_ring_buffer const& other)
+        : inplace_ring_buffer(other.begin(), other.end())
+    {
+    }
+    constexpr inplace_ring_buffer(inplace_ring_buffer&& other)
+    {
+        for (auto&& e : other)
+            push_back(std::move(e));
+    }
+
+    constexpr auto operator=(inplace_ring_buffer const& other) -> inplace_ring_buffer&
+    {
+        if (this != &other)
+        {
+            clear();
+            for (auto&& e : other)
+                push_back(e);
+        }
+        return *this;
+    }
+
+    constexpr auto operator=(inplace_ring_buffer&& other) -> inplace_ring_buffer&
+    {
+        if (this != &other)
+        {
+            clear();
+            for (auto&& e : other)
+                push_back(std::move(e));
+        }
+        return *this;
+    }
+
+    constexpr auto operator=(std::initializer_list<value_type> ilist) -> inplace_ring_buffer&
+    {
+        *this = inplace_ring_buffer{ilist};
+        return *this;
+    }
+
+    constexpr auto at(size_type pos) -> reference
+    {
+        if (pos >= size())
+            throw std::out_of_range{"inplace_ring_buffer::at"};
+        return (*this)[pos];
+    }
+    constexpr auto at(size_type pos) const -> const_reference
+    {
+        if (pos >= size())
+            throw std::out_of_range{"inplace_ring_buffer::at"};
+        return (*this)[pos];
+    }
+
+    constexpr auto operator[](size_type pos) -> reference { return array[physical_index(pos)]; }
+    constexpr auto operator[](size_type pos) const -> const_reference { return array[physical_index(pos)]; }
+
+    constexpr auto front() -> reference { return array[head]; }
+    constexpr auto front() const -> const_reference { return array[head]; }
+
+    constexpr auto back() -> reference { return (*this)[count - 1]; }
+    constexpr auto back() const -> const_reference { return (*this)[count - 1]; }
+
+    constexpr auto begin() noexcept -> iterator { return iterator{this, 0}; }
+    constexpr auto begin() const noexcept -> const_iterator { return const_iterator{this, 0}; }
+    constexpr auto cbegin() const noexcept -> const_iterator { return begin(); }
+
+    constexpr auto end() noexcept -> iterator { return iterator{this, static_cast<difference_type>(count)}; }
+    constexpr auto end() const noexcept -> const_iterator
+    {
+        return const_iterator{this, static_cast<difference_type>(count)};
+    }
+    constexpr auto cend() const noexcept -> const_iterator { return end(); }
+
+    constexpr auto rbegin() noexcept -> reverse_iterator { return std::make_reverse_iterator(end()); }
+    constexpr auto rbegin() const noexcept -> const_reverse_iterator { return std::make_reverse_iterator(end()); }
+    constexpr auto crbegin() const noexcept -> const_reverse_iterator { return rbegin(); }
+
+    constexpr auto rend() noexcept -> reverse_iterator { return std::make_reverse_iterator(begin()); }
+    constexpr auto rend() const noexcept -> const_reverse_iterator { return std::make_reverse_iterator(begin()); }
+    constexpr auto crend() const noexcept -> const_reverse_iterator { return rend(); }
+
+    [[nodiscard]] constexpr auto        empty() const noexcept -> bool { return count == 0; }
+    [[nodiscard]] constexpr auto        full() const noexcept -> bool { return count == Capacity; }
+    [[nodiscard]] constexpr auto        size() const noexcept -> size_type { return count; }
+    [[nodiscard]] constexpr static auto capacity() noexcept -> size_type { return Capacity; }
+
+    constexpr void clear() noexcept
+    {
+        for (size_type i = 0; i < count; ++i)
+            array.destroy_at(physical_index(i));
+        head  = 0;
+        count = 0;
+    }
+
+    constexpr void push_back(const_reference value) { emplace_back(value); }
+    constexpr void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+    template<typename... Args>
+    constexpr auto emplace_back(Args&&... args) -> reference
+    {
+        CTRX_PRECONDITION(size() < capacity());
+        auto const idx = physical_index(count);
+        array.construct_at(idx, std::forward<Args>(args)...);
+        ++count;
+        return array[idx];
+    }
+
+    constexpr void push_front(const_reference value) { emplace_front(value); }
+    constexpr void push_front(value_type&& value) { emplace_front(std::move(value)); }
+
+    template<typename... Args>
+    constexpr auto emplace_front(Args&&... args) -> reference
+    {
+        CTRX_PRECONDITION(size() < capacity());
+        auto const idx = wrap(head + Capacity - 1);
+        array.construct_at(idx, std::forward<Args>(args)...);
+        head = idx;
+        ++count;
+        return array[idx];
+    }
+
+    constexpr void pop_back()
+    {
+        CTRX_PRECONDITION(!empty());
+        array.destroy_at(physical_index(count - 1));
+        --count;
+    }
+
+    constexpr void pop_front()
+    {
+        CTRX_PRECONDITION(!empty());
+        array.destroy_at(head);
+        head = wrap(head + 1);
+        --count;
+    }
+
+    /// Returns the stored elements as two contiguous spans, in order
+    ///
+    /// # Notes
+    /// The second span is empty unless the content wraps around the end of the underlying storage. Only available if
+    /// the underlying storage exposes its data, i.e. if `T` is trivially default constructible and destructible.
+    constexpr auto as_spans() noexcept -> pair<std::span<value_type>, std::span<value_type>>
+        requires requires(uninitialized_array<T, Capacity>& a) { a.data(); }
+    {
+        auto const first_size = std::min(count, Capacity - head);
+        return {std::span<value_type>{array.data() + head, first_size},
+                std::span<value_type>{array.data(), count - first_size}};
+    }
+
+    /// Returns the stored elements as two contiguous spans, in order
+    ///
+    /// # Notes
+    /// The second span is empty unless the content wraps around the end of the underlying storage. Only available if
+    /// the underlying storage exposes its data, i.e. if `T` is trivially default constructible and destructible.
+    constexpr auto as_spans() const noexcept -> pair<std::span<value_type const>, std::span<value_type const>>
+        requires requires(uninitialized_array<T, Capacity> const& a) { a.data(); }
+    {
+        auto const first_size = std::min(count, Capacity - head);
+        return {std::span<value_type const>{array.data() + head, first_size},
+                std::span<value_type const>{array.data(), count - first_size}};
+    }
+
+    constexpr auto operator==(inplace_ring_buffer const& other) const -> bool
+    {
+        return std::ranges::equal(begin(), end(), other.begin(), other.end());
+    }
+    constexpr auto operator<=>(inplace_ring_buffer const& rhs) const
+        requires(std::three_way_comparable<value_type>)
+    {
+        return std::lexicographical_compare_three_way(begin(), end(), rhs.begin(), rhs.end());
+    }
+
+    // -- internal API
+
+    static constexpr auto wrap(size_type idx) noexcept -> size_type
+    {
+        if constexpr (std::has_single_bit(Capacity))
+            return idx & (Capacity - 1);
+        else
+            return idx >= Capacity ? idx - Capacity : idx;
+    }
+    constexpr auto physical_index(size_type pos) const noexcept -> size_type { return wrap(head + pos); }
+
+    uninitialized_array<T, Capacity> array{};
+    size_type                        head  = 0;
+    size_type                        count = 0;
+};
+
+template<typename T, std::size_t Capacity, typename U>
+constexpr auto erase(inplace_ring_buffer<T, Capacity>& c, U const& value) ->
+    typename inplace_ring_buffer<T, Capacity>::size_type
+{
+    auto it = std::remove(c.begin(), c.end(), value);
+    auto r  = std::distance(it, c.end());
+    for (auto i = r; i > 0; --i)
+        c.pop_back();
+    return r;
+}
+
+template<typename T, std::size_t Capacity, typename Pred>
+constexpr auto erase_if(inplace_ring_buffer<T, Capacity>& c, Pred pred) ->
+    typename inplace_ring_buffer<T, Capacity>::size_type
+{
+    auto it = std::remove_if(c.begin(), c.end(), pred);
+    auto r  = std::distance(it, c.end());
+    for (auto i = r; i > 0; --i)
+        c.pop_back();
+    return r;
+}
+} // namespace structural
+
+#endif // STRUCTURAL_INPLACE_RING_BUFFER_HPP
@@ -0,0 +1,259 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_INPLACE_SLOT_MAP_HPP
+#define STRUCTURAL_INPLACE_SLOT_MAP_HPP
+
+#include "structural/inplace_vector.hpp"
+
+#include <ctrx/contracts.hpp>
+
+#include <array>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace structural
+{
+/// Stable identifier of an element in an inplace_slot_map
+///
+/// # Notes
+/// A handle stays valid until its element is erased. Afterwards, the slot may be reused, but the generation of the
+/// slot changes, so that stale handles are reliably rejected. A default-constructed handle is never valid.
+struct slot_handle
+{
+    std::uint32_t index      = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t generation = 0;
+
+    constexpr auto operator==(slot_handle const&) const -> bool = default;
+};
+
+/// Fixed-capacity container that hands out stable, generational handles to its elements.
+///
+/// # Notes
+/// Insertion, removal and lookup by handle are O(1). The elements are stored densely, so iteration only visits
+/// live elements, but erasing an element moves the last element into its place. Iteration order is therefore not
+/// stable across erasure.
+template<typename T, std::size_t Capacity>
+    requires(Capacity < std::numeric_limits<std::uint32_t>::max())
+struct inplace_slot_map
+{
+    using key_type               = slot_handle;
+    using value_type             = inplace_vector<T, Capacity>::value_type;
+    using size_type              = inplace_vector<T, Capacity>::size_type;
+    using difference_type        = inplace_vector<T, Capacity>::difference_type;
+    using reference              = inplace_vector<T, Capacity>::reference;
+    using const_reference        = inplace_vector<T, Capacity>::const_reference;
+    using pointer                = inplace_vector<T, Capacity>::pointer;
+    using const_pointer          = inplace_vector<T, Capacity>::const_pointer;
+    using iterator               = inplace_vector<T, Capacity>::iterator;
+    using const_iterator         = inplace_vector<T, Capacity>::const_iterator;
+    using reverse_iterator       = inplace_vector<T, Capacity>::reverse_iterator;
+    using const_reverse_iterator = inplace_vector<T, Capacity>::const_reverse_iterator;
+
+    // Odd generations mark occupied slots, even generations free ones.
+    struct slot_t
+    {
+        std::uint32_t generation = 0;
+        std::uint32_t idx        = 0; // Index into values if occupied, next free slot otherwise
+    };
+
+    constexpr inplace_slot_map()
+    {
+        std::uint32_t i = 0;
+        for (auto& s : slots)
+            s.idx = ++i;
+    }
+
+    /// Inserts a copy of value and returns its handle
+    ///
+    /// # Requires
+    /// size() < Capacity
+    constexpr auto insert(const_reference value) -> key_type { return emplace(value); }
+    /// Inserts value and returns its handle
+    ///
+    /// # Requires
+    /// size() < Capacity
+    constexpr auto insert(value_type&& value) -> key_type { return emplace(std::move(value)); }
+
+    /// Constructs an element in-place and returns its handle
+    ///
+    /// # Requires
+    /// size() < Capacity
+    template<typename... Args>
+    constexpr auto emplace(Args&&... args) -> key_type
+    {
+        CTRX_PRECONDITION(size() < capacity());
+        auto const value_idx = static_cast<std::uint32_t>(values.size());
+        values.emplace_back(std::forward<Args>(args)...);
+        slot_of[value_idx] = allocate_slot(value_idx);
+        return key_of(begin() + value_idx);
+    }
+
+    /// Erases the element referred to by key, if any. Returns the number of erased elements.
+    constexpr auto erase(key_type key) -> size_type
+    {
+        if (!contains(key))
+            return 0;
+        erase_at(slots[key.index].idx);
+        return 1;
+    }
+
+    /// Erases the element at pos
+    ///
+    /// # Return value
+    /// An iterator to the element that took the place of the erased one, or end() if pos was the last element.
+    constexpr auto erase(const_iterator pos) -> iterator
+    {
+        auto const idx = static_cast<size_type>(pos - begin());
+        erase_at(idx);
+        return begin() + idx;
+    }
+
+    /// Returns whether key refers to an element of this container
+    [[nodiscard]] constexpr auto contains(key_type key) const noexcept -> bool
+    {
+        return key.index < Capacity && slots[key.index].generation == key.generation && (key.generation & 1u) != 0;
+    }
+
+    /// Returns an iterator to the element referred to by key, or end() if there is none
+    constexpr auto find(key_type key) -> iterator { return contains(key) ? begin() + slots[key.index].idx : end(); }
+    /// Returns an iterator to the element referred to by key, or end() if there is none
+    constexpr auto find(key_type key) const -> const_iterator
+    {
+        return contains(key) ? begin() + slots[key.index].idx : end();
+    }
+
+    /// Returns a reference to the element referred to by key. If there is none, throws std::out_of_range.
+    constexpr auto at(key_type key) -> reference { return const_cast<reference>(std::as_const(*this).at(key)); }
+    /// Returns a reference to the element referred to by key. If there is none, throws std::out_of_range.
+    constexpr auto at(key_type key) const -> const_reference
+    {
+        if (!contains(key))
+            throw std::out_of_range("inplace_slot_map::at");
+        return values[slots[key.index].idx];
+    }
+
+    /// Returns a reference to the element referred to by key
+    ///
+    /// # Requires
+    /// contains(key)
+    constexpr auto operator[](key_type key) -> reference
+    {
+        CTRX_PRECONDITION(contains(key));
+        return values[slots[key.index].idx];
+    }
+    /// Returns a reference to the element referred to by key
+    ///
+    /// # Requires
+    /// contains(key)
+    constexpr auto operator[](key_type key) const -> const_reference
+    {
+        CTRX_PRECONDITION(contains(key));
+        return values[slots[key.index].idx];
+    }
+
+    /// Returns the handle of the element at pos
+    ///
+    /// # Requires
+    /// pos must be a dereferenceable iterator into this container
+    constexpr auto key_of(const_iterator pos) const -> key_type
+    {
+        auto const slot_idx = slot_of[static_cast<size_type>(pos - begin())];
+        return {slot_idx, slots[slot_idx].generation};
+    }
+
+    constexpr auto begin() noexcept -> iterator { return values.begin(); }
+    constexpr auto begin() const noexcept -> const_iterator { return values.begin(); }
+    constexpr auto cbegin() const noexcept -> const_iterator { return begin(); }
+
+    constexpr auto end() noexcept -> iterator { return values.end(); }
+    constexpr auto end() const noexcept -> const_iterator { return values.end(); }
+    constexpr auto cend() const noexcept -> const_iterator { return end(); }
+
+    constexpr auto rbegin() noexcept -> reverse_iterator { return values.rbegin(); }
+    constexpr auto rbegin() const noexcept -> const_reverse_iterator { return values.rbegin(); }
+    constexpr auto crbegin() const noexcept -> const_reverse_iterator { return rbegin(); }
+
+    constexpr auto rend() noexcept -> reverse_iterator { return values.rend(); }
+    constexpr auto rend() const noexcept -> const_reverse_iterator { return values.rend(); }
+    constexpr auto crend() const noexcept -> const_reverse_iterator { return rend(); }
+
+    [[nodiscard]] constexpr auto        empty() const noexcept -> bool { return values.empty(); }
+    [[nodiscard]] constexpr auto        size() const noexcept -> size_type { return values.size(); }
+    [[nodiscard]] constexpr static auto capacity() noexcept -> size_type { return Capacity; }
+
+    /// Erases all elements. All handles become invalid.
+    constexpr void clear() noexcept
+    {
+        while (!empty())
+            erase_at(size() - 1);
+    }
+
+    // -- internal API
+
+    constexpr auto allocate_slot(std::uint32_t value_idx) -> std::uint32_t
+    {
+        CTRX_PRECONDITION(next_free_idx < Capacity);
+        std::uint32_t const idx = next_free_idx;
+        next_free_idx           = slots[idx].idx;
+        slots[idx].idx          = value_idx;
+        ++slots[idx].generation;
+        return idx;
+    }
+
+    constexpr void deallocate_slot(std::uint32_t idx)
+    {
+        CTRX_PRECONDITION(idx < Capacity);
+        slots[idx].idx = next_free_idx;
+        ++slots[idx].generation;
+        next_free_idx = idx;
+    }
+
+    constexpr void erase_at(size_type value_idx)
+    {
+        CTRX_PRECONDITION(value_idx < size());
+        auto const slot_idx = slot_of[value_idx];
+        auto const last     = size() - 1;
+        if (value_idx != last)
+        {
+            values[value_idx]             = std::move(values[last]);
+            slot_of[value_idx]            = slot_of[last];
+            slots[slot_of[value_idx]].idx = static_cast<std::uint32_t>(value_idx);
+        }
+        values.pop_back();
+        deallocate_slot(slot_idx);
+    }
+
+    inplace_vector<T, Capacity>         values{};
+    std::array<std::uint32_t, Capacity> slot_of{}; // Slot index for each element of values
+    std::array<slot_t, Capacity>        slots{};
+    std::uint32_t                       next_free_idx = 0;
+};
+} // namespace structural
+
+#endif // STRUCTURAL_INPLACE_SLOT_MAP_HPP
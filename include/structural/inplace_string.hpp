@@ -43,6 +43,10 @@ using inplace_u16string = basic_inplace_string<char16_t, Capacity>;
 
 template<std::size_t Capacity>
 using inplace_u32string = basic_inplace_string<char32_t, Capacity>;
+
+/// A string that keeps its unused capacity zeroed, so that comparisons don't depend on its size
+template<std::size_t Capacity>
+using inplace_zp_string = basic_inplace_string<char, Capacity, zero_padded_traits<char>>;
 } // namespace structural
 
 #endif // STRUCTURAL_INPLACE_STRING_HPP
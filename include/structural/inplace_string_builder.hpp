@@ -0,0 +1,272 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_INPLACE_STRING_BUILDER_HPP
+#define STRUCTURAL_INPLACE_STRING_BUILDER_HPP
+
+#include "structural/basic_inplace_string.hpp"
+
+#include <algorithm>
+#include <iosfwd>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <string_view>
+
+#include <cstddef>
+
+namespace structural
+{
+/// What writing into a full basic_inplace_string through a sink does
+enum class overflow_policy
+{
+    /// Drops the characters that don't fit and records the overflow
+    truncate,
+    /// Reports an error: appenders throw std::length_error, stream buffers make the stream fail
+    fail,
+};
+
+/// Output iterator that appends to a basic_inplace_string, usable as the target of std::format_to or std::ranges::copy
+///
+/// # Notes
+/// Doesn't invalidate any iterators, references or pointers into the string.
+template<typename CharT,
+         std::size_t     Capacity,
+         typename Traits        = std::char_traits<CharT>,
+         overflow_policy Policy = overflow_policy::fail>
+struct basic_inplace_string_appender
+{
+    using iterator_category = std::output_iterator_tag;
+    using value_type        = void;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = void;
+    using string_type       = basic_inplace_string<CharT, Capacity, Traits>;
+
+    constexpr basic_inplace_string_appender() noexcept = default;
+
+    /// Constructs an appender that writes to the end of `str`
+    constexpr explicit basic_inplace_string_appender(string_type& str) noexcept
+        : target(&str)
+    {
+    }
+
+    /// Appends `ch` to the string
+    ///
+    /// # Notes
+    /// If the string is full, either drops `ch` or throws std::length_error, depending on Policy.
+    constexpr auto operator=(CharT ch) -> basic_inplace_string_appender&
+    {
+        if (target->size() < Capacity)
+            target->push_back(ch);
+        else if constexpr (Policy == overflow_policy::truncate)
+            truncated = true;
+        else
+            throw std::length_error{"basic_inplace_string_appender: string is full"};
+        return *this;
+    }
+
+    constexpr auto operator*() noexcept -> basic_inplace_string_appender& { return *this; }
+    constexpr auto operator++() noexcept -> basic_inplace_string_appender& { return *this; }
+    constexpr auto operator++(int) noexcept -> basic_inplace_string_appender { return *this; }
+
+    /// Returns whether characters were dropped by this appender, or by the one it was copied from
+    [[nodiscard]] constexpr auto overflowed() const noexcept -> bool { return truncated; }
+
+    // -- internal API
+
+    string_type* target    = nullptr;
+    bool         truncated = false;
+};
+
+/// Returns an output iterator that appends to `str`
+template<overflow_policy Policy = overflow_policy::fail, typename CharT, std::size_t Capacity, typename Traits>
+constexpr auto appender(basic_inplace_string<CharT, Capacity, Traits>& str) noexcept
+    -> basic_inplace_string_appender<CharT, Capacity, Traits, Policy>
+{
+    return basic_inplace_string_appender<CharT, Capacity, Traits, Policy>(str);
+}
+
+/// Stream buffer that writes straight into the unused capacity of a basic_inplace_string
+///
+/// # Notes
+/// - The string's size only reflects the written characters after a flush, pubsync() or destruction of this buffer.
+/// - Overflow drops the remaining characters, and either reports success or makes the stream fail, depending on Policy.
+/// - Doesn't support input or seeking.
+template<typename CharT,
+         std::size_t     Capacity,
+         typename Traits        = std::char_traits<CharT>,
+         overflow_policy Policy = overflow_policy::fail>
+class basic_inplace_streambuf : public std::basic_streambuf<CharT, Traits>
+{
+public:
+    using char_type   = CharT;
+    using traits_type = Traits;
+    using int_type    = typename Traits::int_type;
+    using string_type = basic_inplace_string<CharT, Capacity, Traits>;
+
+    /// Constructs a buffer that appends to `str`
+    explicit basic_inplace_streambuf(string_type& str) noexcept
+        : target(&str)
+    {
+        reset_put_area();
+    }
+
+    ~basic_inplace_streambuf() override { commit(); }
+
+    basic_inplace_streambuf(basic_inplace_streambuf const&)                    = delete;
+    basic_inplace_streambuf(basic_inplace_streambuf&&)                         = delete;
+    auto operator=(basic_inplace_streambuf const&) -> basic_inplace_streambuf& = delete;
+    auto operator=(basic_inplace_streambuf&&) -> basic_inplace_streambuf&      = delete;
+
+    /// Returns whether characters were dropped because the string was full
+    [[nodiscard]] auto overflowed() const noexcept -> bool { return truncated; }
+
+    /// Returns the target string, with its size updated
+    auto str() -> string_type const&
+    {
+        commit();
+        return *target;
+    }
+
+    /// Continues writing at the end of the target string, after it was modified by other means
+    void reset() noexcept
+    {
+        reset_put_area();
+        truncated = false;
+    }
+
+protected:
+    auto sync() -> int override
+    {
+        commit();
+        return 0;
+    }
+
+    // Only called once the put area is full
+    auto overflow(int_type ch) -> int_type override
+    {
+        if (Traits::eq_int_type(ch, Traits::eof()))
+            return Traits::not_eof(ch);
+        truncated = true;
+        if constexpr (Policy == overflow_policy::truncate)
+            return Traits::not_eof(ch);
+        else
+            return Traits::eof();
+    }
+
+    auto xsputn(CharT const* s, std::streamsize count) -> std::streamsize override
+    {
+        auto const n = std::min(count, static_cast<std::streamsize>(this->epptr() - this->pptr()));
+        Traits::copy(this->pptr(), s, static_cast<std::size_t>(n));
+        // setp instead of pbump, which takes an int
+        this->setp(this->pptr() + n, this->epptr());
+        if (n == count)
+            return n;
+        truncated = true;
+        return Policy == overflow_policy::truncate ? count : n;
+    }
+
+private:
+    void reset_put_area() noexcept { this->setp(target->data() + target->size(), target->data() + Capacity); }
+
+    void commit()
+    {
+        auto const size = static_cast<std::size_t>(this->pptr() - target->data());
+        target->resize_and_overwrite(size, [size](CharT*, std::size_t) { return size; });
+    }
+
+    string_type* target;
+    bool         truncated = false;
+};
+
+/// Output stream that writes into an inline basic_inplace_string, a drop-in replacement for std::ostringstream
+///
+/// # Notes
+/// No dynamic memory is allocated for the characters; the stream itself may still use the heap, e.g. for its locale.
+template<typename CharT,
+         std::size_t     Capacity,
+         typename Traits        = std::char_traits<CharT>,
+         overflow_policy Policy = overflow_policy::fail>
+class basic_inplace_string_builder : public std::basic_ostream<CharT, Traits>
+{
+public:
+    using string_type    = basic_inplace_string<CharT, Capacity, Traits>;
+    using streambuf_type = basic_inplace_streambuf<CharT, Capacity, Traits, Policy>;
+
+    // Like std::basic_ostringstream, the base class only stores the address of the not yet constructed buffer
+
+    /// Constructs a builder with an empty string
+    basic_inplace_string_builder()
+        : std::basic_ostream<CharT, Traits>(&buffer)
+    {
+    }
+
+    /// Constructs a builder that appends to a copy of `str`
+    explicit basic_inplace_string_builder(string_type const& str)
+        : std::basic_ostream<CharT, Traits>(&buffer)
+        , string(str)
+    {
+    }
+
+    basic_inplace_string_builder(basic_inplace_string_builder const&)                    = delete;
+    basic_inplace_string_builder(basic_inplace_string_builder&&)                         = delete;
+    auto operator=(basic_inplace_string_builder const&) -> basic_inplace_string_builder& = delete;
+    auto operator=(basic_inplace_string_builder&&) -> basic_inplace_string_builder&      = delete;
+
+    /// Returns the built string
+    [[nodiscard]] auto str() -> string_type const& { return buffer.str(); }
+
+    /// Returns a view of the built string
+    [[nodiscard]] auto view() -> std::basic_string_view<CharT, Traits> { return str(); }
+
+    /// Replaces the built string with `str` and clears the stream's error state
+    void str(string_type const& s)
+    {
+        string = s;
+        buffer.reset();
+        this->clear();
+    }
+
+    /// Returns whether characters were dropped because the string was full
+    [[nodiscard]] auto overflowed() const noexcept -> bool { return buffer.overflowed(); }
+
+    /// Returns the underlying stream buffer
+    [[nodiscard]] auto rdbuf() const noexcept -> streambuf_type* { return const_cast<streambuf_type*>(&buffer); }
+
+private:
+    string_type    string;
+    streambuf_type buffer{string};
+};
+
+template<std::size_t Capacity, overflow_policy Policy = overflow_policy::fail>
+using inplace_string_builder = basic_inplace_string_builder<char, Capacity, std::char_traits<char>, Policy>;
+
+template<std::size_t Capacity, overflow_policy Policy = overflow_policy::fail>
+using inplace_wstring_builder = basic_inplace_string_builder<wchar_t, Capacity, std::char_traits<wchar_t>, Policy>;
+} // namespace structural
+
+#endif // STRUCTURAL_INPLACE_STRING_BUILDER_HPP
@@ -210,8 +210,8 @@ struct inplace_unordered_map
     constexpr auto try_emplace(Key const& k, Args&&... args) -> pair<iterator, bool>
     {
         return data.emplace(std::piecewise_construct,
-                            forward_as_tuple(k),
-                            forward_as_tuple(std::forward<Args>(args)...));
+                            structural::forward_as_tuple(k),
+                            structural::forward_as_tuple(std::forward<Args>(args)...));
     }
 
     /// Inserts an element constructed from args, if no element with equivalent key is already contained
@@ -230,8 +230,8 @@ struct inplace_unordered_map
     constexpr auto try_emplace(Key&& k, Args&&... args) -> pair<iterator, bool>
     {
         return data.emplace(std::piecewise_construct,
-                            forward_as_tuple(std::move(k)),
-                            forward_as_tuple(std::forward<Args>(args)...));
+                            structural::forward_as_tuple(std::move(k)),
+                            structural::forward_as_tuple(std::forward<Args>(args)...));
     }
 
     /// Removes an element from the container
@@ -25,12 +25,18 @@
 #ifndef STRUCTURAL_INPLACE_VECTOR_HPP
 #define STRUCTURAL_INPLACE_VECTOR_HPP
 
+#include "structural/detail/relocate.hpp"
 #include "structural/uninitialized_array.hpp"
 
 #include <ctrx/contracts.hpp>
 
 #include <algorithm>
 #include <compare>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
 
 #include <cstddef>
 
@@ -150,32 +156,36 @@ struct inplace_vector
         count = 0;
     }
 
-    constexpr auto insert(const_iterator pos, const_reference value) -> iterator { return insert(pos, {value}); }
-    constexpr auto insert(const_iterator pos, value_type&& value) -> iterator
-    {
-        CTRX_PRECONDITION(size() < capacity());
-        if (pos == end())
-        {
-            push_back(std::move(value));
-            return end() - 1;
-        }
-
-        push_back(std::move(back()));
-        for (auto iter = (end() - 1); iter != pos; --iter)
-            *iter = std::move(*(iter - 1));
-        iterator insertion_pos = begin() + (pos - begin());
-        *insertion_pos         = std::move(value);
-        return insertion_pos;
-    }
+    constexpr auto insert(const_iterator pos, const_reference value) -> iterator { return emplace(pos, value); }
+    constexpr auto insert(const_iterator pos, value_type&& value) -> iterator { return emplace(pos, std::move(value)); }
     template<std::input_iterator Iter, std::sentinel_for<Iter> Sentinel>
     constexpr auto insert(const_iterator pos, Iter first, Sentinel last) -> iterator
     {
+        auto const idx = static_cast<size_type>(pos - begin());
+        if constexpr (std::forward_iterator<Iter>)
+        {
+            if (!may_alias(first))
+            {
+                auto const n         = static_cast<size_type>(std::ranges::distance(first, last));
+                auto const old_count = count;
+                CTRX_PRECONDITION(n <= capacity() - size());
+                open_gap(idx, n);
+                for (size_type i = idx; i < idx + n; ++i, ++first)
+                {
+                    if (i < old_count)
+                        array[i] = *first;
+                    else
+                        array.construct_at(i, *first);
+                }
+                count += n;
+                return begin() + idx;
+            }
+        }
         auto middle = end();
         for (std::input_iterator auto iter = first; iter != last; ++iter)
             push_back(*iter);
-        iterator mutable_pos = begin() + (pos - begin());
-        std::ranges::rotate(mutable_pos, middle, end());
-        return mutable_pos;
+        std::ranges::rotate(begin() + idx, middle, end());
+        return begin() + idx;
     }
     constexpr auto insert(const_iterator pos, std::initializer_list<T> ilist) -> iterator
     {
@@ -185,11 +195,20 @@ struct inplace_vector
     template<typename... Args>
     constexpr auto emplace(const_iterator pos, Args&&... args) -> iterator
     {
-        auto middle = end();
-        emplace_back(std::forward<Args>(args)...);
-        iterator mutable_pos = begin() + (pos - begin());
-        std::ranges::rotate(mutable_pos, middle, end());
-        return mutable_pos;
+        CTRX_PRECONDITION(size() < capacity());
+        auto const idx = static_cast<size_type>(pos - begin());
+        if (idx == count)
+        {
+            emplace_back(std::forward<Args>(args)...);
+            return end() - 1;
+        }
+
+        // Construct first, since args may refer to elements that are about to be shifted.
+        value_type value(std::forward<Args>(args)...);
+        open_gap(idx, 1);
+        array[idx] = std::move(value);
+        ++count;
+        return begin() + idx;
     }
 
     constexpr auto erase(const_iterator pos) -> iterator { return erase(pos, pos + 1); }
@@ -250,6 +269,43 @@ struct inplace_vector
 
     // -- internal API
 
+    // Whether a range starting at first might point into this vector. Such ranges can't be inserted by opening a gap,
+    // since that would shift the source elements while they're being read.
+    template<typename Iter>
+    constexpr auto may_alias(Iter first) const -> bool
+    {
+        if constexpr (std::contiguous_iterator<Iter> && std::same_as<std::iter_value_t<Iter>, value_type>)
+        {
+            if (std::is_constant_evaluated())
+                return true;
+            auto const* p = std::to_address(first);
+            return !std::less<>{}(p, std::to_address(begin())) && std::less<>{}(p, std::to_address(end()));
+        }
+        else
+            return std::same_as<Iter, iterator> || std::same_as<Iter, const_iterator>;
+    }
+
+    // Shifts [pos, end()) back by n slots without changing count. Slots of the resulting gap below the old end() hold
+    // moved-from elements, the ones above are uninitialized.
+    constexpr void open_gap(size_type pos, size_type n)
+    {
+        if constexpr (detail::trivially_relocatable<T> && requires { array.data(); })
+        {
+            if (!std::is_constant_evaluated())
+            {
+                detail::relocate_backward(array.data() + pos, array.data() + count, array.data() + count + n);
+                return;
+            }
+        }
+        for (size_type i = count; i-- > pos;)
+        {
+            if (i + n >= count)
+                array.construct_at(i + n, std::move(array[i]));
+            else
+                array[i + n] = std::move(array[i]);
+        }
+    }
+
     uninitialized_array<T, Capacity> array{};
     size_type                        count = 0;
 };
@@ -26,12 +26,17 @@
 #define STRUCTURAL_NAMED_BITSET_HPP
 
 #include "bitset.hpp"
-#include "structural/detail/split.hpp"
+#include "structural/detail/name_table.hpp"
 #include "structural/detail/to_underlying.hpp"
-#include "structural/detail/trim.hpp"
+#include "structural/inplace_string.hpp"
 
 #include <ctrx/contracts.hpp>
 
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <functional>
+#include <optional>
 #include <ranges>
 #include <string>
 #include <string_view>
@@ -59,23 +64,19 @@
     };                                                                                                                 \
     static constexpr std::size_t bitset_name##_size = std::ranges::count(std::string_view{#__VA_ARGS__}, ',') + 1;     \
     using bitset_name                               = structural::named_bitset<enum_name, bitset_name##_size>;         \
+    inline constexpr auto bitset_name##_names =                                                                        \
+        structural::detail::make_name_table<bitset_name##_size, structural::detail::name_list_chars(#__VA_ARGS__)>(    \
+            #__VA_ARGS__);                                                                                             \
+    constexpr auto structural_name_table(enum_name) noexcept -> auto const& { return bitset_name##_names; }            \
     STRUCTURAL_MAKE_NAMED_BITSET_IMPL_GEN_OP(&, enum_name, bitset_name)                                                \
     STRUCTURAL_MAKE_NAMED_BITSET_IMPL_GEN_OP(|, enum_name, bitset_name)                                                \
     STRUCTURAL_MAKE_NAMED_BITSET_IMPL_GEN_OP(^, enum_name, bitset_name)                                                \
                                                                                                                        \
     constexpr auto to_string_view(enum_name e) -> std::string_view                                                     \
     {                                                                                                                  \
-        constexpr auto names = []()                                                                                    \
-        {                                                                                                              \
-            auto names = structural::detail::split<bitset_name##_size>(#__VA_ARGS__, ',');                             \
-            std::ranges::transform(names,                                                                              \
-                                   names.begin(),                                                                      \
-                                   [](std::string_view sv) { return structural::detail::trim(sv); });                  \
-            return names;                                                                                              \
-        }();                                                                                                           \
         auto const idx = structural::detail::to_underlying(e);                                                         \
-        CTRX_ASSERT(std::size_t(idx) < names.size());                                                                       \
-        return names[idx];                                                                                             \
+        CTRX_ASSERT(std::size_t(idx) < bitset_name##_size);                                                            \
+        return bitset_name##_names.name(std::size_t(idx));                                                             \
     }                                                                                                                  \
     auto to_string(enum_name e) -> std::string                                                                         \
     {                                                                                                                  \
@@ -84,6 +85,12 @@
 
 namespace structural
 {
+namespace detail
+{
+// Separates the names of the set flags in named_bitset::to_string() and to_inplace_string()
+inline constexpr std::string_view flag_name_separator = " | ";
+} // namespace detail
+
 template<typename Enum, std::size_t N>
     requires(std::is_enum_v<Enum>)
 struct named_bitset
@@ -118,6 +125,38 @@ struct named_bitset
     [[nodiscard]] constexpr auto        count() const noexcept { return bits.count(); }
     [[nodiscard]] static constexpr auto size() noexcept { return N; }
 
+    /// The lowest set flag, if any
+    [[nodiscard]] constexpr auto find_first() const noexcept -> std::optional<Enum>
+    {
+        return to_enum(bits.find_first());
+    }
+
+    /// The lowest set flag above e, if any
+    [[nodiscard]] constexpr auto find_next(Enum e) const noexcept -> std::optional<Enum>
+    {
+        return to_enum(bits.find_next(detail::to_underlying(e)));
+    }
+
+    /// The highest set flag, if any
+    [[nodiscard]] constexpr auto find_last() const noexcept -> std::optional<Enum>
+    {
+        return to_enum(bits.find_last());
+    }
+
+    /// Range over the set flags, in ascending order
+    [[nodiscard]] constexpr auto set_bits() const noexcept
+    {
+        return bits.set_bits() | std::views::transform([](std::size_t i) { return static_cast<Enum>(i); });
+    }
+
+    /// Calls fn(e) for each set flag e, in ascending order
+    template<typename Fn>
+        requires std::invocable<Fn&, Enum>
+    constexpr void for_each_set(Fn fn) const
+    {
+        bits.for_each_set([&](std::size_t i) { std::invoke(fn, static_cast<Enum>(i)); });
+    }
+
     [[maybe_unused]] constexpr auto set() noexcept -> named_bitset&
     {
         bits.set();
@@ -157,15 +196,39 @@ struct named_bitset
     template<class CharT = char, class Traits = std::char_traits<CharT>, class Allocator = std::allocator<CharT>>
     [[nodiscard]] auto to_string() const -> std::basic_string<CharT, Traits, Allocator>
     {
+        // Size the result up front so appending the names never reallocates.
+        std::size_t size = 0;
+        for_each_set([&](Enum e) { size += to_string_view(e).size() + detail::flag_name_separator.size(); });
+
         std::basic_string<CharT, Traits, Allocator> str;
-        for (std::size_t i = 0; i < bits.size(); ++i)
-            if (bits.test(i))
+        str.reserve(size);
+        for_each_set(
+            [&](Enum e)
             {
                 if (!str.empty())
-                    str += " | ";
-                auto const sv = to_string_view(Enum(i));
-                str += sv;
-            }
+                    str += detail::flag_name_separator;
+                str += to_string_view(e);
+            });
+        return str;
+    }
+
+    /// Like to_string(), e.g. "red | blue", but without allocating
+    ///
+    /// # Requires
+    /// Enum was declared with STRUCTURAL_MAKE_NAMED_BITSET.
+    template<detail::enum_with_name_table E = Enum>
+    [[nodiscard]] constexpr auto to_inplace_string() const
+        -> inplace_string<detail::name_table_of<E>::chars_size + (N - 1) * detail::flag_name_separator.size()>
+    {
+        auto const& names = structural_name_table(E{});
+        inplace_string<detail::name_table_of<E>::chars_size + (N - 1) * detail::flag_name_separator.size()> str;
+        for_each_set(
+            [&](Enum e)
+            {
+                if (!str.empty())
+                    str += detail::flag_name_separator;
+                str += names.name(std::size_t(detail::to_underlying(e)));
+            });
         return str;
     }
 
@@ -224,8 +287,32 @@ struct named_bitset
     }
 
     bitset<N> bits;
+
+private:
+    static constexpr auto to_enum(std::size_t i) noexcept -> std::optional<Enum>
+    {
+        if (i == bitset<N>::npos)
+            return std::nullopt;
+        return static_cast<Enum>(i);
+    }
 };
 
+/// Returns the enumerator named str, or an empty optional if there is none
+///
+/// # Requires
+/// Enum was declared with STRUCTURAL_MAKE_NAMED_BITSET.
+///
+/// # Complexity
+/// One hash and one string comparison.
+template<detail::enum_with_name_table Enum>
+[[nodiscard]] constexpr auto from_string_view(std::string_view str) noexcept -> std::optional<Enum>
+{
+    std::size_t const idx = structural_name_table(Enum{}).find(str);
+    if (idx == detail::name_table_of<Enum>::size)
+        return std::nullopt;
+    return static_cast<Enum>(idx);
+}
+
 template<typename Enum, std::size_t N>
     requires(std::is_enum_v<Enum>)
 constexpr auto operator&(named_bitset<Enum, N> const& lhs, named_bitset<Enum, N> const& rhs) noexcept
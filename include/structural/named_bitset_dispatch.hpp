@@ -0,0 +1,276 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_NAMED_BITSET_DISPATCH_HPP
+#define STRUCTURAL_NAMED_BITSET_DISPATCH_HPP
+
+#include "structural/named_bitset.hpp"
+
+#include <ctrx/contracts.hpp>
+
+#include <array>
+#include <functional>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace structural
+{
+namespace detail
+{
+// Stands in for "no flags" in the template arguments of a dispatch case
+struct no_flags
+{
+};
+
+template<typename T>
+inline constexpr bool is_named_bitset = false;
+template<typename Enum, std::size_t N>
+inline constexpr bool is_named_bitset<named_bitset<Enum, N>> = true;
+
+// The flags of a dispatch case as a Bitset; Flags is an enumerator, a Bitset or no_flags
+template<typename Bitset, auto Flags>
+constexpr auto dispatch_flags() noexcept -> Bitset
+{
+    if constexpr (std::is_same_v<std::remove_cv_t<decltype(Flags)>, no_flags>)
+        return Bitset{};
+    else
+        return Bitset{Flags};
+}
+
+template<auto Required, auto Forbidden>
+struct dispatch_condition
+{
+};
+
+// Maps flags to the index of the first case they match, or to the number of cases if they match none.
+//
+// Flags that no case mentions can't change the outcome. The outcome of all combinations of the others is tabulated at
+// compile time, indexed by the packed word of small bitsets or by the packed mentioned flags of larger ones. Cases
+// that mention too many flags for a table are tested one after another.
+template<typename Bitset, typename... Conditions>
+struct dispatch_plan;
+
+template<typename Bitset, auto... Required, auto... Forbidden>
+struct dispatch_plan<Bitset, dispatch_condition<Required, Forbidden>...>
+{
+    static constexpr std::size_t max_table_bits = 12;
+    static constexpr std::size_t case_count     = sizeof...(Required);
+
+    static constexpr std::array<Bitset, case_count> required  = {dispatch_flags<Bitset, Required>()...};
+    static constexpr std::array<Bitset, case_count> forbidden = {dispatch_flags<Bitset, Forbidden>()...};
+
+    static constexpr Bitset mentioned = []
+    {
+        Bitset result;
+        for (std::size_t i = 0; i < case_count; ++i)
+            result |= required[i] | forbidden[i];
+        return result;
+    }();
+
+    static constexpr bool by_word    = Bitset::size() <= max_table_bits;
+    static constexpr bool tabulated  = by_word || mentioned.count() <= max_table_bits;
+    static constexpr auto table_bits = by_word ? Bitset::size() : tabulated ? mentioned.count() : 0;
+
+    static constexpr auto positions = []
+    {
+        std::array<std::size_t, by_word ? 0 : table_bits> result{};
+        if constexpr (!by_word && tabulated)
+        {
+            std::size_t i = 0;
+            mentioned.bits.for_each_set([&](std::size_t pos) { result[i++] = pos; });
+        }
+        return result;
+    }();
+
+    static constexpr auto key(Bitset const& flags) -> std::size_t
+    {
+        if constexpr (by_word)
+            return static_cast<std::size_t>(flags.to_ullong());
+        else
+        {
+            return [&]<std::size_t... I>(std::index_sequence<I...>)
+            { return ((std::size_t{flags.bits.test(positions[I])} << I) | ... | std::size_t{0}); }(
+                       std::make_index_sequence<positions.size()>{});
+        }
+    }
+
+    using index_t = std::conditional_t<(case_count < 256), std::uint8_t, std::uint16_t>;
+
+    static constexpr auto table = []
+    {
+        std::array<index_t, std::size_t{1} << table_bits> result{};
+        if constexpr (tabulated)
+        {
+            std::array<std::size_t, case_count> required_keys{};
+            std::array<std::size_t, case_count> forbidden_keys{};
+            for (std::size_t i = 0; i < case_count; ++i)
+            {
+                required_keys[i]  = key(required[i]);
+                forbidden_keys[i] = key(forbidden[i]);
+            }
+            for (std::size_t k = 0; k < result.size(); ++k)
+            {
+                std::size_t i = 0;
+                while (i < case_count && ((k & required_keys[i]) != required_keys[i] || (k & forbidden_keys[i]) != 0))
+                    ++i;
+                result[k] = static_cast<index_t>(i);
+            }
+        }
+        return result;
+    }();
+
+    static constexpr auto select(Bitset const& flags) -> std::size_t
+    {
+        if constexpr (tabulated)
+            return table[key(flags)];
+        else
+        {
+            std::size_t i = 0;
+            while (i < case_count && !(flags.test_all(required[i]) && flags.test_none(forbidden[i])))
+                ++i;
+            return i;
+        }
+    }
+
+    // Whether all flags match some case
+    static constexpr bool exhaustive = []
+    {
+        for (std::size_t i = 0; i < case_count; ++i)
+        {
+            if (required[i].none() && forbidden[i].none())
+                return true;
+        }
+        if constexpr (tabulated)
+        {
+            for (auto const idx : table)
+            {
+                if (idx == case_count)
+                    return false;
+            }
+            return true;
+        }
+        return false;
+    }();
+};
+
+template<typename Handler>
+struct dispatch_handler_traits;
+
+// Calls the handler of the selected case, if any. The fold is a flat chain of comparisons with selected, which
+// compilers turn into a jump table.
+template<typename Result, typename... Handlers>
+constexpr auto dispatch_call(std::size_t selected, Handlers&... handlers) -> Result
+{
+    return [&]<std::size_t... I>(std::index_sequence<I...>) -> Result
+    {
+        auto const handler = [&]<std::size_t J>() -> auto& { return std::get<J>(std::tie(handlers...)).fn; };
+        if constexpr (std::is_void_v<Result>)
+            (void)((selected == I && (std::invoke(handler.template operator()<I>()), true)) || ...);
+        else
+        {
+            // Result is a decayed type, as produced by std::common_type
+            std::optional<Result> result;
+            (void)((selected == I && (result.emplace(std::invoke(handler.template operator()<I>())), true)) || ...);
+            CTRX_ASSERT(result.has_value());
+            return *std::move(result);
+        }
+    }(std::index_sequence_for<Handlers...>{});
+}
+} // namespace detail
+
+/// A case of dispatch(), matching all flags in which Required are set and Forbidden are clear
+template<auto Required, auto Forbidden, typename Fn>
+struct dispatch_case
+{
+    Fn fn;
+};
+
+namespace detail
+{
+template<auto Required, auto Forbidden, typename Fn>
+struct dispatch_handler_traits<dispatch_case<Required, Forbidden, Fn>>
+{
+    using condition = dispatch_condition<Required, Forbidden>;
+    using result    = std::invoke_result_t<Fn&>;
+};
+
+template<typename Handler>
+using dispatch_traits_t = dispatch_handler_traits<std::remove_cvref_t<Handler>>;
+template<typename... Handlers>
+using dispatch_result_t = std::common_type_t<typename dispatch_traits_t<Handlers>::result...>;
+template<typename Bitset, typename... Handlers>
+using dispatch_plan_t = dispatch_plan<Bitset, typename dispatch_traits_t<Handlers>::condition...>;
+} // namespace detail
+
+/// Creates a case of dispatch() that calls fn()
+///
+/// Required and Forbidden are each an enumerator or a named_bitset of the dispatched type; Forbidden may be omitted.
+template<auto Required, auto Forbidden = detail::no_flags{}, typename Fn>
+constexpr auto when(Fn fn) -> dispatch_case<Required, Forbidden, Fn>
+{
+    return {std::move(fn)};
+}
+
+/// Creates a case of dispatch() that matches any flags and calls fn()
+template<typename Fn>
+constexpr auto otherwise(Fn fn) -> dispatch_case<detail::no_flags{}, detail::no_flags{}, Fn>
+{
+    return {std::move(fn)};
+}
+
+/// Calls the handler of the first case that matches flags and returns its result, like a chain of if-else on
+/// test_all() and test_none()
+///
+/// Which case matches which flags is worked out at compile time, so dispatching takes one table lookup and one indexed
+/// jump, however many cases there are. The table is indexed by the packed word for bitsets of up to 12 flags; larger
+/// bitsets are indexed by the packed flags that the cases mention.
+///
+/// # Requires
+/// Either the handlers return void, or every combination of flags matches some case, e.g. because the last case is
+/// otherwise(). Flags that match no case are then ignored.
+///
+/// # Notes
+/// Cases that mention more than 12 distinct flags of a bitset with more than 12 flags are too large to tabulate and are
+/// tested one after another.
+///
+/// # Complexity
+/// Constant when tabulated, otherwise linear in the number of cases.
+template<typename Bitset, typename... Handlers>
+    requires(detail::is_named_bitset<Bitset>)
+constexpr auto dispatch(Bitset const& flags, Handlers&&... handlers) -> detail::dispatch_result_t<Handlers...>
+{
+    using result_t = detail::dispatch_result_t<Handlers...>;
+    using plan_t   = detail::dispatch_plan_t<Bitset, Handlers...>;
+    static_assert(std::is_void_v<result_t> || plan_t::exhaustive);
+
+    return detail::dispatch_call<result_t>(plan_t::select(flags), handlers...);
+}
+} // namespace structural
+
+#endif // STRUCTURAL_NAMED_BITSET_DISPATCH_HPP
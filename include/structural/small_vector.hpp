@@ -0,0 +1,538 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_SMALL_VECTOR_HPP
+#define STRUCTURAL_SMALL_VECTOR_HPP
+
+#include "structural/detail/relocate.hpp"
+#include "structural/inplace_vector.hpp"
+#include "structural/uninitialized_array.hpp"
+
+#include <ctrx/contracts.hpp>
+
+#include <algorithm>
+#include <compare>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+
+namespace structural
+{
+namespace detail
+{
+// Inline storage of small_vector for types that uninitialized_array can't store contiguously. The bytes can't hold
+// objects during constant evaluation, so it's only used at run time.
+template<typename T, std::size_t N>
+struct small_vector_bytes
+{
+    constexpr small_vector_bytes() noexcept {}
+
+    auto data() noexcept -> T* { return reinterpret_cast<T*>(bytes); }
+    auto data() const noexcept -> T const* { return reinterpret_cast<T const*>(bytes); }
+
+    alignas(T) std::byte bytes[N * sizeof(T)];
+};
+} // namespace detail
+
+/// Stores up to `N` elements within the object and moves them to memory obtained from `Allocator` if more are needed.
+///
+/// # Notes
+/// Unlike inplace_vector, this type is not structural, since it may own allocated memory. Iterators are plain pointers;
+/// all of them are invalidated when the elements move between inline and allocated storage. During constant evaluation,
+/// elements are only stored inline if T is trivially default constructible and destructible; otherwise, they always
+/// live in allocated memory there.
+template<typename T, std::size_t N, typename Allocator = std::allocator<T>>
+struct small_vector
+{
+    using value_type             = T;
+    using allocator_type         = Allocator;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using reference              = value_type&;
+    using const_reference        = value_type const&;
+    using pointer                = value_type*;
+    using const_pointer          = value_type const*;
+    using iterator               = pointer;
+    using const_iterator         = const_pointer;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    constexpr ~small_vector()
+    {
+        clear();
+        deallocate_heap();
+    }
+
+    constexpr small_vector() = default;
+    constexpr explicit small_vector(Allocator const& alloc) noexcept
+        : alloc(alloc)
+    {
+    }
+    constexpr small_vector(size_type count, const_reference value, Allocator const& alloc = Allocator())
+        : alloc(alloc)
+    {
+        reserve(count);
+        for (size_type i = 0; i < count; ++i)
+            emplace_back(value);
+    }
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sentinel>
+    constexpr small_vector(Iter first, Sentinel last, Allocator const& alloc = Allocator())
+        : alloc(alloc)
+    {
+        insert(end(), first, last);
+    }
+    constexpr small_vector(std::initializer_list<T> init, Allocator const& alloc = Allocator())
+        : small_vector(init.begin(), init.end(), alloc)
+    {
+    }
+    template<std::size_t Capacity>
+    constexpr explicit small_vector(inplace_vector<T, Capacity> const& other, Allocator const& alloc = Allocator())
+        : small_vector(other.begin(), other.end(), alloc)
+    {
+    }
+
+    constexpr small_vector(small_vector const& other)
+        : small_vector(other.begin(),
+                       other.end(),
+                       std::allocator_traits<Allocator>::select_on_container_copy_construction(other.alloc))
+    {
+    }
+    constexpr small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : alloc(std::move(other.alloc))
+    {
+        steal(other);
+    }
+
+    constexpr auto operator=(small_vector const& other) -> small_vector&
+    {
+        if (this != &other)
+            assign(other.begin(), other.end());
+        return *this;
+    }
+    constexpr auto operator=(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) -> small_vector&
+    {
+        if (this != &other)
+        {
+            clear();
+            if (other.is_inline() || alloc == other.alloc)
+            {
+                deallocate_heap();
+                steal(other);
+            }
+            else
+            {
+                for (auto&& e : other)
+                    emplace_back(std::move(e));
+                other.clear();
+            }
+        }
+        return *this;
+    }
+    constexpr auto operator=(std::initializer_list<T> ilist) -> small_vector&
+    {
+        assign(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sentinel>
+    constexpr void assign(Iter first, Sentinel last)
+    {
+        clear();
+        insert(end(), first, last);
+    }
+    constexpr void assign(std::initializer_list<T> ilist) { assign(ilist.begin(), ilist.end()); }
+
+    /// Converts to an inplace_vector
+    ///
+    /// # Requires
+    /// size() <= `Capacity`
+    template<std::size_t Capacity>
+    constexpr explicit operator inplace_vector<T, Capacity>() const
+    {
+        CTRX_PRECONDITION(size() <= Capacity);
+        return inplace_vector<T, Capacity>(begin(), end());
+    }
+
+    [[nodiscard]] constexpr auto get_allocator() const noexcept -> allocator_type { return alloc; }
+
+    constexpr auto at(size_type pos) -> reference
+    {
+        if (pos >= size())
+            throw std::out_of_range{"small_vector::at"};
+        return data()[pos];
+    }
+    constexpr auto at(size_type pos) const -> const_reference
+    {
+        if (pos >= size())
+            throw std::out_of_range{"small_vector::at"};
+        return data()[pos];
+    }
+
+    constexpr auto operator[](size_type pos) -> reference { return data()[pos]; }
+    constexpr auto operator[](size_type pos) const -> const_reference { return data()[pos]; }
+
+    constexpr auto front() -> reference { return data()[0]; }
+    constexpr auto front() const -> const_reference { return data()[0]; }
+
+    constexpr auto back() -> reference { return data()[count - 1]; }
+    constexpr auto back() const -> const_reference { return data()[count - 1]; }
+
+    constexpr auto data() noexcept -> pointer { return heap_data ? heap_data : inline_data(); }
+    constexpr auto data() const noexcept -> const_pointer { return heap_data ? heap_data : inline_data(); }
+
+    constexpr auto begin() noexcept -> iterator { return data(); }
+    constexpr auto begin() const noexcept -> const_iterator { return data(); }
+    constexpr auto cbegin() const noexcept -> const_iterator { return begin(); }
+
+    constexpr auto end() noexcept -> iterator { return data() + count; }
+    constexpr auto end() const noexcept -> const_iterator { return data() + count; }
+    constexpr auto cend() const noexcept -> const_iterator { return end(); }
+
+    constexpr auto rbegin() noexcept -> reverse_iterator { return std::make_reverse_iterator(end()); }
+    constexpr auto rbegin() const noexcept -> const_reverse_iterator { return std::make_reverse_iterator(end()); }
+    constexpr auto crbegin() const noexcept -> const_reverse_iterator { return rbegin(); }
+
+    constexpr auto rend() noexcept -> reverse_iterator { return std::make_reverse_iterator(begin()); }
+    constexpr auto rend() const noexcept -> const_reverse_iterator { return std::make_reverse_iterator(begin()); }
+    constexpr auto crend() const noexcept -> const_reverse_iterator { return rend(); }
+
+    [[nodiscard]] constexpr auto        empty() const noexcept -> bool { return count == 0; }
+    [[nodiscard]] constexpr auto        size() const noexcept -> size_type { return count; }
+    [[nodiscard]] constexpr static auto inline_capacity() noexcept -> size_type { return N; }
+    [[nodiscard]] constexpr auto        capacity() const noexcept -> size_type
+    {
+        return is_inline() ? inline_limit() : heap_capacity;
+    }
+
+    /// Checks whether the elements are currently stored within the object
+    [[nodiscard]] constexpr auto is_inline() const noexcept -> bool { return heap_data == nullptr; }
+
+    constexpr void reserve(size_type new_capacity)
+    {
+        if (new_capacity > capacity())
+            reallocate(new_capacity);
+    }
+
+    /// Moves the elements back into inline storage if they fit, or into a smaller allocation otherwise
+    constexpr void shrink_to_fit()
+    {
+        if (is_inline() || count == heap_capacity)
+            return;
+        if (count <= inline_limit())
+        {
+            detail::relocate(heap_data, heap_data + count, inline_data());
+            deallocate_heap();
+        }
+        else
+            reallocate(count);
+    }
+
+    constexpr void clear() noexcept
+    {
+        std::destroy(begin(), end());
+        count = 0;
+    }
+
+    constexpr auto insert(const_iterator pos, const_reference value) -> iterator { return emplace(pos, value); }
+    constexpr auto insert(const_iterator pos, value_type&& value) -> iterator { return emplace(pos, std::move(value)); }
+    template<std::input_iterator Iter, std::sentinel_for<Iter> Sentinel>
+    constexpr auto insert(const_iterator pos, Iter first, Sentinel last) -> iterator
+    {
+        auto const offset = pos - begin();
+        if constexpr (std::forward_iterator<Iter>)
+        {
+            if (may_alias(first))
+            {
+                // Opening the gap would move or reallocate the source, so insert from a copy instead
+                small_vector copy(alloc);
+                copy.reserve(static_cast<size_type>(std::ranges::distance(first, last)));
+                for (; first != last; ++first)
+                    copy.emplace_back(*first);
+                return insert(pos, std::make_move_iterator(copy.begin()), std::make_move_iterator(copy.end()));
+            }
+            auto const n = static_cast<size_type>(std::ranges::distance(first, last));
+            open_gap(offset, n);
+            auto const gap         = begin() + offset;
+            size_type  constructed = 0;
+            try
+            {
+                for (; constructed < n; ++first, ++constructed)
+                    std::construct_at(gap + constructed, *first);
+            }
+            catch (...)
+            {
+                // Close the gap again, such that the vector holds the same elements as before
+                std::destroy(gap, gap + constructed);
+                detail::relocate(gap + n, end() + n, gap);
+                throw;
+            }
+            count += n;
+        }
+        else
+        {
+            auto const old_size = count;
+            for (; first != last; ++first)
+                emplace_back(*first);
+            std::rotate(begin() + offset, begin() + old_size, end());
+        }
+        return begin() + offset;
+    }
+    constexpr auto insert(const_iterator pos, std::initializer_list<T> ilist) -> iterator
+    {
+        return insert(pos, ilist.begin(), ilist.end());
+    }
+
+    template<typename... Args>
+    constexpr auto emplace(const_iterator pos, Args&&... args) -> iterator
+    {
+        auto const offset = pos - begin();
+        if (offset == static_cast<difference_type>(count))
+        {
+            emplace_back(std::forward<Args>(args)...);
+            return end() - 1;
+        }
+        // args might refer to an element of this vector, so construct the new value before moving anything
+        value_type value(std::forward<Args>(args)...);
+        open_gap(offset, 1);
+        std::construct_at(begin() + offset, std::move(value));
+        ++count;
+        return begin() + offset;
+    }
+
+    constexpr auto erase(const_iterator pos) -> iterator { return erase(pos, pos + 1); }
+    constexpr auto erase(const_iterator first, const_iterator last) -> iterator
+    {
+        auto const mutable_first = begin() + (first - begin());
+        auto const mutable_last  = begin() + (last - begin());
+        if (first != last)
+        {
+            std::destroy(mutable_first, mutable_last);
+            detail::relocate(mutable_last, end(), mutable_first);
+            count -= last - first;
+        }
+        return mutable_first;
+    }
+
+    constexpr void push_back(const_reference value) { emplace_back(value); }
+    constexpr void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+    template<typename... Args>
+    constexpr auto emplace_back(Args&&... args) -> reference
+    {
+        if (count == capacity())
+        {
+            // args might refer to an element of this vector, so construct into the new storage before relocating
+            auto const new_capacity = grown_capacity(count + 1);
+            auto const new_data     = std::allocator_traits<Allocator>::allocate(alloc, new_capacity);
+            try
+            {
+                std::construct_at(new_data + count, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                std::allocator_traits<Allocator>::deallocate(alloc, new_data, new_capacity);
+                throw;
+            }
+            adopt(new_data, new_capacity);
+        }
+        else
+            std::construct_at(end(), std::forward<Args>(args)...);
+        ++count;
+        return back();
+    }
+
+    constexpr void pop_back()
+    {
+        CTRX_PRECONDITION(!empty());
+        std::destroy_at(end() - 1);
+        --count;
+    }
+
+    constexpr void resize(size_type new_size) { resize_impl(new_size); }
+    constexpr void resize(size_type new_size, const_reference value) { resize_impl(new_size, value); }
+
+    constexpr auto operator==(small_vector const& other) const -> bool
+    {
+        return std::ranges::equal(begin(), end(), other.begin(), other.end());
+    }
+    constexpr auto operator<=>(small_vector const& rhs) const
+        requires(std::three_way_comparable<value_type>)
+    {
+        return std::lexicographical_compare_three_way(begin(), end(), rhs.begin(), rhs.end());
+    }
+
+    // -- internal API
+
+    static constexpr bool contiguous_inline_buffer = N == 0 || requires(uninitialized_array<T, N>& a) { a.data(); };
+
+    using inline_buffer_type =
+        std::conditional_t<contiguous_inline_buffer, uninitialized_array<T, N>, detail::small_vector_bytes<T, N>>;
+
+    // The number of elements that fit into the inline buffer in the current context
+    static constexpr auto inline_limit() noexcept -> size_type
+    {
+        if constexpr (contiguous_inline_buffer)
+            return N;
+        else
+            return std::is_constant_evaluated() ? 0 : N;
+    }
+
+    constexpr auto inline_data() noexcept -> pointer
+    {
+        if constexpr (N == 0)
+            return nullptr;
+        else if constexpr (contiguous_inline_buffer)
+            return inline_buffer.data();
+        else
+            return std::is_constant_evaluated() ? nullptr : inline_buffer.data();
+    }
+    constexpr auto inline_data() const noexcept -> const_pointer
+    {
+        if constexpr (N == 0)
+            return nullptr;
+        else if constexpr (contiguous_inline_buffer)
+            return inline_buffer.data();
+        else
+            return std::is_constant_evaluated() ? nullptr : inline_buffer.data();
+    }
+
+    // Whether a range starting at first might point into this vector. Such ranges can't be inserted by opening a gap,
+    // since that would move the source elements while they're being read.
+    template<typename Iter>
+    constexpr auto may_alias(Iter first) const -> bool
+    {
+        if constexpr (std::contiguous_iterator<Iter> && std::same_as<std::iter_value_t<Iter>, value_type>)
+        {
+            if (std::is_constant_evaluated())
+                return true;
+            auto const* p = std::to_address(first);
+            return !std::less<>{}(p, begin()) && std::less<>{}(p, end());
+        }
+        else
+            return false;
+    }
+
+    constexpr auto grown_capacity(size_type required) const noexcept -> size_type
+    {
+        return std::max(required, 2 * capacity());
+    }
+
+    // Moves all elements into new_data, which has room for new_capacity elements, and releases the old storage
+    constexpr void adopt(pointer new_data, size_type new_capacity) noexcept
+    {
+        detail::relocate(begin(), end(), new_data);
+        deallocate_heap();
+        heap_data     = new_data;
+        heap_capacity = new_capacity;
+    }
+
+    constexpr void reallocate(size_type new_capacity)
+    {
+        adopt(std::allocator_traits<Allocator>::allocate(alloc, new_capacity), new_capacity);
+    }
+
+    // Turns [offset, offset + n) into uninitialized storage by moving subsequent elements back. count is not changed.
+    constexpr void open_gap(difference_type offset, size_type n)
+    {
+        if (count + n > capacity())
+        {
+            auto const new_capacity = grown_capacity(count + n);
+            auto const new_data     = std::allocator_traits<Allocator>::allocate(alloc, new_capacity);
+            detail::relocate(begin() + offset, end(), new_data + offset + n);
+            detail::relocate(begin(), begin() + offset, new_data);
+            deallocate_heap();
+            heap_data     = new_data;
+            heap_capacity = new_capacity;
+        }
+        else
+            detail::relocate_backward(begin() + offset, end(), end() + n);
+    }
+
+    constexpr void deallocate_heap() noexcept
+    {
+        if (heap_data)
+            std::allocator_traits<Allocator>::deallocate(alloc, heap_data, heap_capacity);
+        heap_data     = nullptr;
+        heap_capacity = 0;
+    }
+
+    // Takes over the content of other, which must have a compatible allocator. Expects this to be empty and inline.
+    constexpr void steal(small_vector& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (other.is_inline())
+            detail::relocate(other.begin(), other.end(), inline_data());
+        else
+        {
+            heap_data     = std::exchange(other.heap_data, nullptr);
+            heap_capacity = std::exchange(other.heap_capacity, 0);
+        }
+        count = std::exchange(other.count, 0);
+    }
+
+    template<typename... Args>
+    constexpr void resize_impl(size_type new_size, Args const&... value)
+    {
+        if (new_size < count)
+            erase(begin() + new_size, end());
+        else
+        {
+            reserve(new_size);
+            while (count < new_size)
+                emplace_back(value...);
+        }
+    }
+
+    inline_buffer_type              inline_buffer{};
+    pointer                         heap_data     = nullptr;
+    size_type                       heap_capacity = 0;
+    size_type                       count         = 0;
+    [[no_unique_address]] Allocator alloc{};
+};
+
+template<typename T, std::size_t N, typename Allocator, typename U>
+constexpr auto erase(small_vector<T, N, Allocator>& c, U const& value) -> small_vector<T, N, Allocator>::size_type
+{
+    auto it = std::remove(c.begin(), c.end(), value);
+    auto r  = std::distance(it, c.end());
+    c.erase(it, c.end());
+    return r;
+}
+
+template<typename T, std::size_t N, typename Allocator, typename Pred>
+constexpr auto erase_if(small_vector<T, N, Allocator>& c, Pred pred) -> small_vector<T, N, Allocator>::size_type
+{
+    auto it = std::remove_if(c.begin(), c.end(), pred);
+    auto r  = std::distance(it, c.end());
+    c.erase(it, c.end());
+    return r;
+}
+} // namespace structural
+
+#endif // STRUCTURAL_SMALL_VECTOR_HPP
@@ -0,0 +1,284 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_SPLIT_HPP
+#define STRUCTURAL_SPLIT_HPP
+
+#include "structural/detail/find_kernels.hpp"
+
+#include <concepts>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <cstddef>
+
+namespace structural
+{
+/// A view of the pieces of a string between occurrences of a delimiter
+///
+/// Like `std::views::split`, consecutive delimiters produce empty pieces, a trailing delimiter produces an empty last
+/// piece, and an empty string produces no pieces at all. The pieces are views into the original string, which must
+/// outlive them.
+///
+/// # Notes
+/// At run time, the delimiter is searched with `Traits::find`, which is `memchr` for `std::char_traits<char>`.
+template<typename CharT, typename Traits = std::char_traits<CharT>>
+struct split_view : std::ranges::view_interface<split_view<CharT, Traits>>
+{
+    using string_view_type = std::basic_string_view<CharT, Traits>;
+
+    struct iterator
+    {
+        using value_type       = string_view_type;
+        using difference_type  = std::ptrdiff_t;
+        using iterator_concept = std::forward_iterator_tag;
+
+        constexpr auto operator*() const noexcept -> value_type { return piece; }
+
+        constexpr auto operator++() noexcept -> iterator&
+        {
+            if (piece.size() == rest.size())
+                done = true;
+            else
+            {
+                rest.remove_prefix(piece.size() + 1);
+                piece = rest.substr(0, rest.find(delimiter));
+            }
+            return *this;
+        }
+
+        constexpr auto operator++(int) noexcept -> iterator
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        friend constexpr auto operator==(iterator const& lhs, iterator const& rhs) noexcept -> bool
+        {
+            return lhs.done == rhs.done && lhs.rest.data() == rhs.rest.data();
+        }
+
+        friend constexpr auto operator==(iterator const& it, std::default_sentinel_t) noexcept -> bool
+        {
+            return it.done;
+        }
+
+        // -- internal API
+
+        string_view_type rest;  // Starts at the current piece
+        string_view_type piece; // Ends at the next delimiter or the end of the string
+        CharT            delimiter{};
+        bool             done = true;
+    };
+
+    constexpr split_view() = default;
+    constexpr split_view(string_view_type str, CharT delimiter) noexcept
+        : str(str)
+        , delimiter(delimiter)
+    {
+    }
+
+    /// Returns an iterator to the first piece
+    constexpr auto begin() const noexcept -> iterator
+    {
+        return {str, str.substr(0, str.find(delimiter)), delimiter, str.empty()};
+    }
+
+    /// Returns a sentinel marking the end of the pieces
+    constexpr auto end() const noexcept -> std::default_sentinel_t { return {}; }
+
+    // -- internal API
+
+    string_view_type str;
+    CharT            delimiter{};
+};
+
+namespace detail
+{
+// Position of the first character of sv that is (or, if negate is set, isn't) one of chars
+template<typename CharT, typename Traits>
+constexpr auto find_first_of(std::basic_string_view<CharT, Traits> sv,
+                             std::basic_string_view<CharT, Traits> chars,
+                             bool                                  negate) noexcept -> std::size_t
+{
+    if constexpr (sizeof(CharT) == 1 && std::same_as<Traits, std::char_traits<CharT>>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            return find_kernels::find_of<false>(reinterpret_cast<char const*>(sv.data()),
+                                                sv.size(),
+                                                sv.size(),
+                                                {reinterpret_cast<char const*>(chars.data()), chars.size()},
+                                                negate);
+        }
+    }
+    return negate ? sv.find_first_not_of(chars) : sv.find_first_of(chars);
+}
+} // namespace detail
+
+/// A view of the tokens of a string, separated by runs of any of a set of delimiters
+///
+/// Unlike split_view, this never produces empty tokens: leading, trailing and repeated delimiters are skipped. The
+/// tokens are views into the original string, which must outlive them.
+///
+/// # Notes
+/// At run time and for byte-sized characters, delimiters are searched 16 characters at a time.
+template<typename CharT, typename Traits = std::char_traits<CharT>>
+struct tokenize_view : std::ranges::view_interface<tokenize_view<CharT, Traits>>
+{
+    using string_view_type = std::basic_string_view<CharT, Traits>;
+
+    struct iterator
+    {
+        using value_type       = string_view_type;
+        using difference_type  = std::ptrdiff_t;
+        using iterator_concept = std::forward_iterator_tag;
+
+        constexpr auto operator*() const noexcept -> value_type { return token; }
+
+        constexpr auto operator++() noexcept -> iterator&
+        {
+            rest.remove_prefix(token.size());
+            seek();
+            return *this;
+        }
+
+        constexpr auto operator++(int) noexcept -> iterator
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        friend constexpr auto operator==(iterator const& lhs, iterator const& rhs) noexcept -> bool
+        {
+            return lhs.rest.data() == rhs.rest.data() && lhs.rest.size() == rhs.rest.size();
+        }
+
+        friend constexpr auto operator==(iterator const& it, std::default_sentinel_t) noexcept -> bool
+        {
+            return it.rest.empty();
+        }
+
+        // -- internal API
+
+        // Skips the delimiters at the start of rest and finds the end of the token behind them
+        constexpr void seek() noexcept
+        {
+            auto const first = detail::find_first_of(rest, delimiters, true);
+            rest.remove_prefix(first == string_view_type::npos ? rest.size() : first);
+            token = rest.substr(0, detail::find_first_of(rest, delimiters, false));
+        }
+
+        string_view_type rest;  // Starts at the current token, or is empty at the end
+        string_view_type token; // Ends at the next delimiter or the end of the string
+        string_view_type delimiters;
+    };
+
+    constexpr tokenize_view() = default;
+    constexpr tokenize_view(string_view_type str, string_view_type delimiters) noexcept
+        : str(str)
+        , delimiters(delimiters)
+    {
+    }
+
+    /// Returns an iterator to the first token
+    constexpr auto begin() const noexcept -> iterator
+    {
+        iterator it{str, {}, delimiters};
+        it.seek();
+        return it;
+    }
+
+    /// Returns a sentinel marking the end of the tokens
+    constexpr auto end() const noexcept -> std::default_sentinel_t { return {}; }
+
+    // -- internal API
+
+    string_view_type str;
+    string_view_type delimiters;
+};
+
+/// Returns a view of the pieces of `str` between occurrences of `delimiter`
+///
+/// # Notes
+/// `str` can be anything convertible to `std::basic_string_view<CharT, Traits>`, e.g. a `basic_inplace_string`. It
+/// must outlive the view.
+template<typename CharT, typename Traits = std::char_traits<CharT>>
+constexpr auto split(std::type_identity_t<std::basic_string_view<CharT, Traits>> str, CharT delimiter) noexcept
+    -> split_view<CharT, Traits>
+{
+    return {str, delimiter};
+}
+
+/// Returns a view of the tokens of `str`, separated by runs of any of the characters in `delimiters`
+///
+/// # Notes
+/// `str` can be anything convertible to `std::basic_string_view<CharT, Traits>`, e.g. a `basic_inplace_string`. It
+/// must outlive the view.
+template<typename CharT, typename Traits = std::char_traits<CharT>>
+constexpr auto tokenize(std::type_identity_t<std::basic_string_view<CharT, Traits>> str,
+                        std::basic_string_view<CharT, Traits>                        delimiters) noexcept
+    -> tokenize_view<CharT, Traits>
+{
+    return {str, delimiters};
+}
+
+/// Equivalent to tokenize(str, std::basic_string_view<CharT>(delimiters))
+template<typename CharT>
+constexpr auto tokenize(std::type_identity_t<std::basic_string_view<CharT>> str, CharT const* delimiters) noexcept
+    -> tokenize_view<CharT>
+{
+    return {str, delimiters};
+}
+
+/// Returns a `Container` holding the pieces of `str` between occurrences of `delimiter`
+///
+/// `Container` is filled using `push_back`, which makes `inplace_vector<std::string_view, N>` and
+/// `inplace_vector<inplace_string<M>, N>` (which copies the pieces) good fits.
+///
+/// # Requires
+/// All pieces must fit into `Container`.
+template<typename Container, typename CharT, typename Traits = std::char_traits<CharT>>
+constexpr auto split_into(std::type_identity_t<std::basic_string_view<CharT, Traits>> str, CharT delimiter)
+    -> Container
+{
+    Container result;
+    for (auto piece : split_view<CharT, Traits>(str, delimiter))
+        result.push_back(typename Container::value_type(piece));
+    return result;
+}
+} // namespace structural
+
+template<typename CharT, typename Traits>
+inline constexpr bool std::ranges::enable_borrowed_range<structural::split_view<CharT, Traits>> = true;
+
+template<typename CharT, typename Traits>
+inline constexpr bool std::ranges::enable_borrowed_range<structural::tokenize_view<CharT, Traits>> = true;
+
+#endif // STRUCTURAL_SPLIT_HPP
@@ -0,0 +1,205 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_SPSC_QUEUE_HPP
+#define STRUCTURAL_SPSC_QUEUE_HPP
+
+#include "structural/uninitialized_array.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <iterator>
+#include <optional>
+#include <utility>
+
+#include <cstddef>
+
+namespace structural
+{
+namespace detail
+{
+// std::hardware_destructive_interference_size is not ABI stable, so we hard-code the common value instead.
+inline constexpr std::size_t spsc_queue_cache_line_size = 64;
+} // namespace detail
+
+/// Bounded, lock-free queue for exactly one producer thread and one consumer thread.
+///
+/// # Notes
+/// All elements are stored within the object, no dynamic memory is allocated. Unlike the other containers, this type
+/// is neither structural nor usable in constant expressions. The producer may only call the push functions, the
+/// consumer may only call the pop functions; all other members may be called from either thread.
+template<typename T, std::size_t Capacity>
+    requires(Capacity > 0)
+struct spsc_queue
+{
+    using value_type      = uninitialized_array<T, Capacity>::value_type;
+    using size_type       = uninitialized_array<T, Capacity>::size_type;
+    using reference       = uninitialized_array<T, Capacity>::reference;
+    using const_reference = uninitialized_array<T, Capacity>::const_reference;
+
+    spsc_queue() = default;
+    ~spsc_queue()
+    {
+        auto const t = tail.load(std::memory_order_acquire);
+        for (auto h = head.load(std::memory_order_relaxed); h != t; ++h)
+            array.destroy_at(slot(h));
+    }
+
+    spsc_queue(spsc_queue const&)                    = delete;
+    spsc_queue(spsc_queue&&)                         = delete;
+    auto operator=(spsc_queue const&) -> spsc_queue& = delete;
+    auto operator=(spsc_queue&&) -> spsc_queue&      = delete;
+
+    /// Constructs an element at the back of the queue
+    ///
+    /// # Return value
+    /// true, if the element was inserted; false, if the queue was full.
+    ///
+    /// # Notes
+    /// Must only be called from the producer thread.
+    template<typename... Args>
+    auto try_emplace(Args&&... args) -> bool
+    {
+        auto const t = tail.load(std::memory_order_relaxed);
+        if (free_slots(t) == 0)
+            return false;
+        array.construct_at(slot(t), std::forward<Args>(args)...);
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Equivalent to try_emplace(value)
+    auto try_push(const_reference value) -> bool { return try_emplace(value); }
+    /// Equivalent to try_emplace(std::move(value))
+    auto try_push(value_type&& value) -> bool { return try_emplace(std::move(value)); }
+
+    /// Inserts up to `count` elements read from `first` at the back of the queue
+    ///
+    /// # Return value
+    /// The number of inserted elements.
+    ///
+    /// # Notes
+    /// Must only be called from the producer thread. The inserted elements become visible to the consumer at once.
+    template<std::input_iterator Iter>
+    auto push_n(Iter first, size_type count) -> size_type
+    {
+        auto const t = tail.load(std::memory_order_relaxed);
+        auto const n = std::min(count, free_slots(t, count));
+        for (size_type i = 0; i < n; ++i, ++first)
+            array.construct_at(slot(t + i), *first);
+        tail.store(t + n, std::memory_order_release);
+        return n;
+    }
+
+    /// Removes the front element of the queue
+    ///
+    /// # Return value
+    /// The removed element, or nullopt if the queue was empty.
+    ///
+    /// # Notes
+    /// Must only be called from the consumer thread.
+    auto try_pop() -> std::optional<value_type>
+    {
+        auto const h = head.load(std::memory_order_relaxed);
+        if (used_slots(h) == 0)
+            return std::nullopt;
+        std::optional<value_type> result{std::move(array[slot(h)])};
+        array.destroy_at(slot(h));
+        head.store(h + 1, std::memory_order_release);
+        return result;
+    }
+
+    /// Removes up to `count` elements from the front of the queue and writes them to `out`
+    ///
+    /// # Return value
+    /// The number of removed elements.
+    ///
+    /// # Notes
+    /// Must only be called from the consumer thread. The freed slots become visible to the producer at once.
+    template<std::output_iterator<value_type> Iter>
+    auto pop_n(Iter out, size_type count) -> size_type
+    {
+        auto const h = head.load(std::memory_order_relaxed);
+        auto const n = std::min(count, used_slots(h, count));
+        for (size_type i = 0; i < n; ++i, ++out)
+        {
+            *out = std::move(array[slot(h + i)]);
+            array.destroy_at(slot(h + i));
+        }
+        head.store(h + n, std::memory_order_release);
+        return n;
+    }
+
+    /// Returns the number of elements in the queue
+    ///
+    /// # Notes
+    /// If called while the other thread is modifying the queue, the result may be outdated immediately.
+    [[nodiscard]] auto size() const noexcept -> size_type
+    {
+        auto const h = head.load(std::memory_order_acquire);
+        return tail.load(std::memory_order_acquire) - h;
+    }
+    /// Checks whether the queue has no elements; see size()
+    [[nodiscard]] auto empty() const noexcept -> bool { return size() == 0; }
+    /// Returns `Capacity`
+    [[nodiscard]] static constexpr auto capacity() noexcept -> size_type { return Capacity; }
+
+    // -- internal API
+
+    static constexpr auto slot(size_type idx) noexcept -> size_type
+    {
+        if constexpr (std::has_single_bit(Capacity))
+            return idx & (Capacity - 1);
+        else
+            return idx % Capacity;
+    }
+
+    // Called by the producer. Only reloads the consumer's index if the cached one leaves fewer than `wanted` slots.
+    auto free_slots(size_type t, size_type wanted = 1) -> size_type
+    {
+        if (Capacity - (t - cached_head) < wanted)
+            cached_head = head.load(std::memory_order_acquire);
+        return Capacity - (t - cached_head);
+    }
+
+    // Called by the consumer. Only reloads the producer's index if the cached one leaves fewer than `wanted` elements.
+    auto used_slots(size_type h, size_type wanted = 1) -> size_type
+    {
+        if (cached_tail - h < wanted)
+            cached_tail = tail.load(std::memory_order_acquire);
+        return cached_tail - h;
+    }
+
+    // head and tail are monotonic counters; slot() maps them into the array. Each index shares a cache line only with
+    // the cached copy of the other index that's used by the same thread.
+    alignas(detail::spsc_queue_cache_line_size) std::atomic<size_type> head{0};
+    size_type cached_tail = 0;
+    alignas(detail::spsc_queue_cache_line_size) std::atomic<size_type> tail{0};
+    size_type cached_head = 0;
+    alignas(detail::spsc_queue_cache_line_size) uninitialized_array<T, Capacity> array{};
+};
+} // namespace structural
+
+#endif // STRUCTURAL_SPSC_QUEUE_HPP
@@ -0,0 +1,217 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_SYMBOL_TABLE_HPP
+#define STRUCTURAL_SYMBOL_TABLE_HPP
+
+#include "structural/detail/perfect_hash.hpp"
+#include "structural/hash.hpp"
+#include "structural/inplace_string.hpp"
+#include "structural/inplace_unordered_map.hpp"
+#include "structural/inplace_vector.hpp"
+
+#include <ctrx/contracts.hpp>
+
+#include <array>
+#include <compare>
+#include <functional>
+#include <optional>
+#include <string_view>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace structural
+{
+/// An interned string, identified by a small integer
+///
+/// # Notes
+/// Symbols compare and hash by their id alone, so they are only meaningful together with the symbol_table that
+/// created them.
+struct symbol
+{
+    std::uint32_t id;
+
+    friend constexpr auto operator==(symbol const&, symbol const&) -> bool = default;
+    friend constexpr auto operator<=>(symbol const&, symbol const&) = default;
+};
+
+/// A set of strings known at compile time, looked up with a perfect hash
+///
+/// The i-th name gets the symbol with id i, in every symbol_table using this set.
+///
+/// # Requires
+/// The names are unique.
+template<std::size_t MaxLen, inplace_string<MaxLen>... Names>
+struct symbol_set
+{
+    static constexpr std::size_t size = sizeof...(Names);
+
+    static constexpr std::array<std::string_view, size> names{std::string_view(Names)...};
+
+    /// Returns the symbol of str, or an empty optional if str isn't in the set
+    ///
+    /// # Complexity
+    /// One hash and one string comparison.
+    [[nodiscard]] static constexpr auto find(std::string_view str) noexcept -> std::optional<symbol>
+    {
+        std::size_t const idx = lookup.candidate(str);
+        if (idx == size || names[idx] != str)
+            return std::nullopt;
+        return symbol{static_cast<std::uint32_t>(idx)};
+    }
+
+    /// Returns the symbol of Name. Fails to compile if Name isn't in the set.
+    template<inplace_string<MaxLen> Name>
+    [[nodiscard]] static consteval auto symbol_of() noexcept -> symbol
+    {
+        constexpr std::optional<symbol> result = find(Name);
+        static_assert(result.has_value(), "Name is not part of this symbol_set");
+        return *result;
+    }
+
+    // -- internal API
+
+    static constexpr detail::perfect_hash::table<size> lookup = detail::perfect_hash::build(names);
+};
+
+namespace detail
+{
+struct symbol_name_hash
+{
+    using is_transparent = void;
+
+    constexpr auto operator()(std::string_view str) const noexcept -> std::size_t
+    {
+        return static_cast<std::size_t>(perfect_hash::hash(str, 0));
+    }
+};
+
+struct symbol_name_equal
+{
+    using is_transparent = void;
+
+    constexpr auto operator()(std::string_view lhs, std::string_view rhs) const noexcept -> bool { return lhs == rhs; }
+};
+} // namespace detail
+
+/// Interns strings of up to MaxLen characters, so that they can be compared and hashed as small integers
+///
+/// The names of StaticSymbols are interned on construction, with the ids assigned by the symbol_set. Symbols created at
+/// compile time with STRUCTURAL_SYMBOL therefore compare equal to the ones intern() returns for the same string.
+///
+/// # Notes
+/// Performance of intern() degrades towards linear if size() is close to Capacity. It is therefore advisable to chose a
+/// Capacity at least twice of the expected number of symbols.
+template<std::size_t Capacity, std::size_t MaxLen, typename StaticSymbols = symbol_set<MaxLen>>
+struct symbol_table
+{
+    static_assert(StaticSymbols::size <= Capacity);
+
+    using size_type      = std::size_t;
+    using static_symbols = StaticSymbols;
+
+    /// Constructs a table containing the names of StaticSymbols
+    constexpr symbol_table()
+    {
+        for (std::string_view const name : StaticSymbols::names)
+            names.emplace_back(name);
+    }
+
+    /// Returns the symbol of str, adding str to the table if necessary
+    ///
+    /// # Requires
+    /// - str.size() <= MaxLen
+    /// - contains(str) || size() < Capacity
+    constexpr auto intern(std::string_view str) -> symbol
+    {
+        if (auto const s = find(str))
+            return *s;
+
+        CTRX_PRECONDITION(str.size() <= MaxLen);
+        auto const result = symbol{static_cast<std::uint32_t>(names.size())};
+        names.emplace_back(str);
+        dynamic_symbols.try_emplace(names.back(), result);
+        return result;
+    }
+
+    /// Returns the symbol of str, or an empty optional if it wasn't interned yet
+    [[nodiscard]] constexpr auto find(std::string_view str) const -> std::optional<symbol>
+    {
+        if (auto const s = StaticSymbols::find(str))
+            return s;
+        if (auto const iter = dynamic_symbols.find(str); iter != dynamic_symbols.end())
+            return iter->second;
+        return std::nullopt;
+    }
+
+    /// Returns whether str was interned
+    [[nodiscard]] constexpr auto contains(std::string_view str) const -> bool { return find(str).has_value(); }
+
+    /// Returns the string a symbol was interned from
+    ///
+    /// # Requires
+    /// s was returned by this table, or by a table with the same StaticSymbols for a static symbol.
+    [[nodiscard]] constexpr auto name(symbol s) const noexcept -> std::string_view
+    {
+        CTRX_PRECONDITION(s.id < names.size());
+        return names[s.id];
+    }
+
+    /// Returns the number of interned strings
+    [[nodiscard]] constexpr auto size() const noexcept -> size_type { return names.size(); }
+    /// Returns Capacity
+    [[nodiscard]] static constexpr auto capacity() noexcept -> size_type { return Capacity; }
+
+    // -- internal API
+
+    inplace_vector<inplace_string<MaxLen>, Capacity> names;
+    inplace_unordered_map<inplace_string<MaxLen>,
+                          symbol,
+                          Capacity,
+                          detail::symbol_name_hash,
+                          detail::symbol_name_equal>
+        dynamic_symbols;
+};
+
+template<>
+struct hash<symbol>
+{
+    constexpr auto operator()(symbol const& s) const noexcept -> std::size_t { return s.id; }
+};
+} // namespace structural
+
+namespace std
+{
+template<>
+struct hash<structural::symbol>
+{
+    constexpr auto operator()(structural::symbol const& s) const noexcept -> std::size_t { return s.id; }
+};
+} // namespace std
+
+/// The compile-time symbol of name in symbol_set_type. Fails to compile if name isn't part of the set.
+#define STRUCTURAL_SYMBOL(symbol_set_type, name) (symbol_set_type::template symbol_of<name>())
+
+#endif // STRUCTURAL_SYMBOL_TABLE_HPP
@@ -0,0 +1,187 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef STRUCTURAL_UTF_HPP
+#define STRUCTURAL_UTF_HPP
+
+#include "structural/basic_inplace_string.hpp"
+#include "structural/detail/utf_kernels.hpp"
+
+#include <ctrx/contracts.hpp>
+
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+#include <cstddef>
+
+namespace structural
+{
+/// Returns whether `str` is well-formed UTF-8
+///
+/// Rejects overlong encodings, surrogates, code points above U+10FFFF and truncated sequences.
+constexpr auto validate_utf8(std::u8string_view str) noexcept -> bool
+{
+    if (std::is_constant_evaluated())
+        return detail::utf::validate_scalar(str.data(), str.size());
+    return detail::utf::validate_utf8(reinterpret_cast<char const*>(str.data()), str.size());
+}
+
+/// Returns whether `str` is well-formed UTF-8
+constexpr auto validate_utf8(std::string_view str) noexcept -> bool
+{
+    if (std::is_constant_evaluated())
+        return detail::utf::validate_scalar(str.data(), str.size());
+    return detail::utf::validate_utf8(str.data(), str.size());
+}
+
+/// Returns whether `str` is well-formed UTF-16, i.e. all surrogates are paired
+constexpr auto validate_utf16(std::u16string_view str) noexcept -> bool
+{
+    return detail::utf::validate_scalar(str.data(), str.size());
+}
+
+/// Returns the number of code points in `str`
+///
+/// # Requires
+/// `str` is valid UTF-8.
+constexpr auto utf8_length(std::u8string_view str) noexcept -> std::size_t
+{
+    if (std::is_constant_evaluated())
+        return detail::utf::utf8_length_scalar(str.data(), str.size());
+    return detail::utf::utf8_length(reinterpret_cast<char const*>(str.data()), str.size());
+}
+
+/// Returns the number of code points in `str`
+///
+/// # Requires
+/// `str` is valid UTF-8.
+constexpr auto utf8_length(std::string_view str) noexcept -> std::size_t
+{
+    if (std::is_constant_evaluated())
+        return detail::utf::utf8_length_scalar(str.data(), str.size());
+    return detail::utf::utf8_length(str.data(), str.size());
+}
+
+/// Returns the number of UTF-16 code units `str` transcodes to
+///
+/// # Requires
+/// `str` is valid UTF-8.
+constexpr auto utf16_length(std::u8string_view str) noexcept -> std::size_t
+{
+    if (std::is_constant_evaluated())
+        return detail::utf::utf16_length_scalar(str.data(), str.size());
+    return detail::utf::utf16_length(reinterpret_cast<char const*>(str.data()), str.size());
+}
+
+/// Returns the number of UTF-16 code units `str` transcodes to
+///
+/// # Requires
+/// `str` is valid UTF-8.
+constexpr auto utf16_length(std::string_view str) noexcept -> std::size_t
+{
+    if (std::is_constant_evaluated())
+        return detail::utf::utf16_length_scalar(str.data(), str.size());
+    return detail::utf::utf16_length(str.data(), str.size());
+}
+
+/// The capacity a string of To needs to hold any string of Capacity From code units after transcoding
+///
+/// # Notes
+/// char is treated as UTF-8, like char8_t.
+template<typename From, typename To, std::size_t Capacity>
+    requires(detail::utf::utf_char<From> && detail::utf::utf_char<To>)
+inline constexpr std::size_t transcoded_capacity = detail::utf::max_transcoded_size<From, To>(Capacity);
+
+namespace detail
+{
+template<typename To, typename From, std::size_t Capacity>
+struct transcode_result
+{
+    using type = basic_inplace_string<To, transcoded_capacity<From, To, Capacity>>;
+};
+
+template<typename To, std::size_t ToCapacity, typename ToTraits, typename From, std::size_t Capacity>
+struct transcode_result<basic_inplace_string<To, ToCapacity, ToTraits>, From, Capacity>
+{
+    using type = basic_inplace_string<To, ToCapacity, ToTraits>;
+};
+} // namespace detail
+
+/// Transcodes `from` between UTF-8 (char8_t or char), UTF-16 (char16_t) and UTF-32 (char32_t)
+///
+/// `To` is either the target code unit type, in which case the result is sized to fit any input, or a
+/// basic_inplace_string specialization.
+///
+/// Returns an empty optional if `from` isn't well-formed.
+///
+/// # Requires
+/// The result must fit into `To`. This holds for any input if its capacity is at least
+/// `transcoded_capacity<CharT, value_type, Capacity>`.
+///
+/// # Notes
+/// At run time, UTF-8 input is validated and transcoded 16 bytes at a time where possible.
+template<typename To, typename CharT, std::size_t Capacity, typename Traits>
+    requires detail::utf::utf_char<CharT>
+constexpr auto transcode(basic_inplace_string<CharT, Capacity, Traits> const& from)
+    -> std::optional<typename detail::transcode_result<To, CharT, Capacity>::type>
+{
+    using result_type = typename detail::transcode_result<To, CharT, Capacity>::type;
+    using to_char     = typename result_type::value_type;
+    static_assert(detail::utf::utf_char<to_char>);
+
+    if constexpr (detail::utf::utf8_char<CharT>)
+    {
+        if (!validate_utf8(std::basic_string_view<CharT>(from.data(), from.size())))
+            return std::nullopt;
+    }
+    else if (!detail::utf::validate_scalar(from.data(), from.size()))
+        return std::nullopt;
+
+    std::size_t length = detail::utf::max_transcoded_size<CharT, to_char>(from.size());
+    if constexpr (result_type::capacity() < transcoded_capacity<CharT, to_char, Capacity>)
+    {
+        length = detail::utf::transcoded_length_scalar<to_char>(from.data(), from.size());
+        CTRX_PRECONDITION(length <= result_type::capacity());
+    }
+
+    result_type result;
+    result.resize_and_overwrite(length,
+                                [&](to_char* out, std::size_t)
+                                {
+                                    if constexpr (detail::utf::utf8_char<CharT> && sizeof(to_char) > 1)
+                                    {
+                                        if (!std::is_constant_evaluated())
+                                        {
+                                            auto const p = reinterpret_cast<char const*>(from.data());
+                                            return detail::utf::transcode_utf8(p, from.size(), out) - out;
+                                        }
+                                    }
+                                    return detail::utf::transcode_scalar(from.data(), from.size(), out) - out;
+                                });
+    return result;
+}
+} // namespace structural
+
+#endif // STRUCTURAL_UTF_HPP
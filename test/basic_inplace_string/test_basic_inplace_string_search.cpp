@@ -0,0 +1,134 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/basic_inplace_string.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <array>
+#include <string_view>
+
+namespace
+{
+constexpr std::string_view search_input = "GET /index.html HTTP/1.1\r\nHost: example.org\r\nAccept: */*\r\n\r\n";
+
+constexpr std::array<std::string_view, 9> search_needles{
+    "", "G", "\r\n", "Host", "HTTP/1.1", " \t", ":/", "example.org\r\nAccept", "not in there"};
+
+template<typename CharT, std::size_t Capacity>
+constexpr auto widen(std::string_view sv) -> structural::basic_inplace_string<CharT, Capacity>
+{
+    structural::basic_inplace_string<CharT, Capacity> result;
+    for (char c : sv)
+        result.push_back(static_cast<CharT>(c));
+    return result;
+}
+
+// Checks that a search function agrees with its std::basic_string_view counterpart for all needles and positions
+template<typename CharT, std::size_t Capacity, typename Search>
+constexpr auto agrees_with_string_view(Search search) -> bool
+{
+    auto const str = widen<CharT, Capacity>(search_input);
+    auto const sv  = std::basic_string_view<CharT>(str);
+    for (auto n : search_needles)
+    {
+        auto const needle = widen<CharT, Capacity>(n);
+        for (std::size_t pos = 0; pos <= str.size() + 1; ++pos)
+        {
+            if (search(str, std::basic_string_view<CharT>(needle), pos)
+                != search(sv, std::basic_string_view<CharT>(needle), pos))
+                return false;
+            if (!needle.empty() && search(str, needle.front(), pos) != search(sv, needle.front(), pos))
+                return false;
+        }
+        if (search(str, std::basic_string_view<CharT>(needle), decltype(str)::npos)
+            != search(sv, std::basic_string_view<CharT>(needle), decltype(sv)::npos))
+            return false;
+    }
+    return true;
+}
+} // namespace
+
+TEST_CASE("basic_inplace_string - search", "[container][inplace_string]")
+{
+    using namespace structural;
+
+    constexpr std::size_t C = 80;
+    bs::static_for_each_type<char, wchar_t, char8_t, char16_t, char32_t>( //
+        [&]<typename value_type>
+        {
+            using test_type = basic_inplace_string<value_type, C>;
+            DYNAMIC_SECTION(bs::stringify_typename<test_type>())
+            {
+                SECTION("find")
+                {
+                    CHECK(agrees_with_string_view<value_type, C>([](auto const& s, auto n, std::size_t pos)
+                                                                 { return s.find(n, pos); }));
+                }
+                SECTION("rfind")
+                {
+                    CHECK(agrees_with_string_view<value_type, C>([](auto const& s, auto n, std::size_t pos)
+                                                                 { return s.rfind(n, pos); }));
+                }
+                SECTION("find_first_of")
+                {
+                    CHECK(agrees_with_string_view<value_type, C>([](auto const& s, auto n, std::size_t pos)
+                                                                 { return s.find_first_of(n, pos); }));
+                }
+                SECTION("find_first_not_of")
+                {
+                    CHECK(agrees_with_string_view<value_type, C>([](auto const& s, auto n, std::size_t pos)
+                                                                 { return s.find_first_not_of(n, pos); }));
+                }
+                SECTION("find_last_of")
+                {
+                    CHECK(agrees_with_string_view<value_type, C>([](auto const& s, auto n, std::size_t pos)
+                                                                 { return s.find_last_of(n, pos); }));
+                }
+                SECTION("find_last_not_of")
+                {
+                    CHECK(agrees_with_string_view<value_type, C>([](auto const& s, auto n, std::size_t pos)
+                                                                 { return s.find_last_not_of(n, pos); }));
+                }
+                SECTION("contains")
+                {
+                    auto const str = widen<value_type, C>(search_input);
+                    CHECK(str.contains(widen<value_type, C>("Host")));
+                    CHECK(str.contains(value_type(':')));
+                    CHECK(!str.contains(widen<value_type, C>("Hosts")));
+                    CHECK(!str.contains(value_type('!')));
+                }
+                SECTION("pointer overloads")
+                {
+                    auto const str    = widen<value_type, C>(search_input);
+                    auto const needle = widen<value_type, C>("Host");
+                    CHECK(str.find(needle.c_str()) == 26);
+                    CHECK(str.find(needle.c_str(), 0, 2) == 26);
+                    CHECK(str.rfind(needle.c_str()) == 26);
+                    CHECK(str.contains(needle.c_str()));
+                }
+            }
+        });
+}
+EVAL_TEST_CASE("basic_inplace_string - search");
@@ -36,5 +36,23 @@ TEST_CASE("basic_inplace_string - structurality", "[container][inplace_string]")
     CHECK(structural_type<basic_inplace_string<char8_t, C>>);
     CHECK(structural_type<basic_inplace_string<char16_t, C>>);
     CHECK(structural_type<basic_inplace_string<char32_t, C>>);
+    CHECK(structural_type<basic_inplace_string<char, 300>>);
+
+    SECTION("compact layout")
+    {
+        CHECK(sizeof(basic_inplace_string<char, 15>) == 16);
+        CHECK(sizeof(basic_inplace_string<char, 255>) == 256);
+        CHECK(sizeof(basic_inplace_string<char16_t, 7>) == 16);
+        CHECK(sizeof(basic_inplace_string<char, 256>) > 257);
+
+        basic_inplace_string<char, 15> full;
+        for (int i = 0; i < 15; ++i)
+            full.push_back('x');
+        CHECK(full.size() == 15);
+        CHECK(full.c_str()[15] == '\0');
+        full.pop_back();
+        CHECK(full.size() == 14);
+        CHECK(full.c_str()[14] == '\0');
+    }
 }
 EVAL_TEST_CASE("basic_inplace_string - structurality");
\ No newline at end of file
@@ -26,6 +26,16 @@
 
 #include <bugspray/bugspray.hpp>
 
+// Ends a range at the null terminator; can't be subtracted from the iterator, unlike the end of a string_view
+struct zstop
+{
+    template<typename CharT>
+    friend constexpr auto operator==(CharT const* iter, zstop) -> bool
+    {
+        return *iter == CharT{};
+    }
+};
+
 TEST_CASE("basic_inplace_string - write access", "[container][inplace_string]")
 {
     using namespace structural;
@@ -60,13 +70,22 @@ TEST_CASE("basic_inplace_string - write access", "[container][inplace_string]")
                         {
                             ss.append(data.begin(), data.end());
                         }
+                        SECTION("iterator + unsized sentinel")
+                        {
+                            ss.append(data.data(), zstop{});
+                        }
                         SECTION("string_view")
                         {
                             ss.append(data);
                         }
+                        SECTION("itself")
+                        {
+                            ss.append(ss);
+                        }
                         CHECK(ss.starts_with(data));
                         CHECK(ss.ends_with(data));
                         CHECK(ss.size() == data.size() * 2);
+                        CHECK(*ss.end() == value_type('\0'));
                     }
                     SECTION("initializer_list")
                     {
@@ -118,6 +137,12 @@ TEST_CASE("basic_inplace_string - write access", "[container][inplace_string]")
                         CHECK(ss.size() == data.size() - 2);
                         CHECK(std::ranges::equal(ss.begin(), ss.end(), data.begin() + 1, data.end() - 1));
                     }
+                    SECTION("iterator + unsized sentinel")
+                    {
+                        ss.assign(data.data() + 1, zstop{});
+                        CHECK(ss.size() == data.size() - 1);
+                        CHECK(std::ranges::equal(ss.begin(), ss.end(), data.begin() + 1, data.end()));
+                    }
                     SECTION("initializer_list")
                     {
                         ss.assign({value_type('a'), value_type('b')});
@@ -258,6 +283,13 @@ TEST_CASE("basic_inplace_string - write access", "[container][inplace_string]")
                             CHECK(std::ranges::equal(iter, iter + data.size(), data.begin(), data.end()));
                             iter += data.size();
                         }
+                        SECTION("iterator + unsized sentinel")
+                        {
+                            iter = ss.insert(ss.begin(), data.data(), zstop{});
+                            CHECK(ss.starts_with(data.data()));
+                            CHECK(std::ranges::equal(iter, iter + data.size(), data.begin(), data.end()));
+                            iter += data.size();
+                        }
                         SECTION("iterator + initializer_list")
                         {
                             iter = ss.insert(ss.begin(), {value_type('v'), value_type('b')});
@@ -0,0 +1,145 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/concept_structural_type_value.hpp"
+#include "structural/inplace_map.hpp"
+#include "structural/inplace_string.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <compare>
+#include <random>
+#include <string_view>
+
+namespace
+{
+template<typename String>
+constexpr auto tail_is_zero(String const& str) -> bool
+{
+    for (std::size_t i = str.size(); i < str.capacity(); ++i)
+    {
+        if (str.data()[i] != '\0')
+            return false;
+    }
+    return true;
+}
+
+template<std::size_t Capacity>
+auto random_string(std::mt19937& rng) -> structural::inplace_zp_string<Capacity>
+{
+    // Few distinct characters and short lengths, so that equal prefixes are common
+    constexpr std::string_view alphabet("ab\0\xff", 4);
+    structural::inplace_zp_string<Capacity> result;
+    std::size_t const                       size = rng() % (Capacity + 1) % 12;
+    for (std::size_t i = 0; i < size; ++i)
+        result.push_back(alphabet[rng() % alphabet.size()]);
+    return result;
+}
+
+template<std::size_t Capacity>
+void check_against_string_view(std::mt19937& rng)
+{
+    for (int round = 0; round < 2000; ++round)
+    {
+        auto const lhs = random_string<Capacity>(rng);
+        auto const rhs = random_string<Capacity>(rng);
+        std::string_view const lsv(lhs.data(), lhs.size());
+        std::string_view const rsv(rhs.data(), rhs.size());
+        CHECK((lhs == rhs) == (lsv == rsv));
+        CHECK((lhs <=> rhs) == (lsv <=> rsv));
+        CHECK((lhs.compare(rhs) < 0) == (lsv < rsv));
+    }
+}
+} // namespace
+
+TEST_CASE("basic_inplace_string - zero padded", "[container][inplace_string]")
+{
+    using namespace structural;
+
+    SECTION("mutations keep the tail zero")
+    {
+        inplace_zp_string<16> str = "hello world";
+        CHECK(tail_is_zero(str));
+        str.pop_back();
+        CHECK(tail_is_zero(str));
+        str.erase(str.begin(), str.begin() + 3);
+        CHECK(str == "lo worl");
+        CHECK(tail_is_zero(str));
+        str.insert(str.begin(), 'x');
+        str.append("yz");
+        CHECK(str == "xlo worlyz");
+        str.assign("ab");
+        CHECK(tail_is_zero(str));
+        str.resize_and_overwrite(16,
+                                 [](char* p, std::size_t n)
+                                 {
+                                     for (std::size_t i = 0; i < n; ++i)
+                                         p[i] = 'q';
+                                     return 3;
+                                 });
+        CHECK(str == "qqq");
+        CHECK(tail_is_zero(str));
+        str.clear();
+        CHECK(tail_is_zero(str));
+        CHECK(str == inplace_zp_string<16>());
+    }
+    SECTION("comparison")
+    {
+        inplace_zp_string<16> const abc = "abc";
+        CHECK(abc == inplace_zp_string<16>("abc"));
+        CHECK(abc != inplace_zp_string<16>("abd"));
+        CHECK(abc < inplace_zp_string<16>("abd"));
+        CHECK(abc > inplace_zp_string<16>("ab"));
+        CHECK(abc < inplace_zp_string<16>("abc\xff"));
+        CHECK(abc == "abc");
+        CHECK(abc.compare("abd") < 0);
+
+        inplace_zp_string<16> const with_null("abc\0", 4);
+        CHECK(abc != with_null);
+        CHECK(abc < with_null);
+        CHECK(abc.compare(with_null) < 0);
+    }
+    SECTION("comparison agrees with string_view", runtime)
+    {
+        std::mt19937 rng(7);
+        check_against_string_view<7>(rng);
+        check_against_string_view<16>(rng);
+        check_against_string_view<21>(rng);
+        check_against_string_view<300>(rng);
+    }
+    SECTION("sorted map keys")
+    {
+        inplace_map<inplace_zp_string<16>, int, 4> map{{"delta", 4}, {"alpha", 1}, {"charlie", 3}, {"bravo", 2}};
+        int expected = 1;
+        for (auto const& [key, value] : map)
+            CHECK(value == expected++);
+        CHECK(map.at("charlie") == 3);
+    }
+    SECTION("structural")
+    {
+        CHECK(structural_type<inplace_zp_string<16>>);
+        CHECK(structural_value<inplace_zp_string<16>("key")>);
+    }
+}
+EVAL_TEST_CASE("basic_inplace_string - zero padded");
@@ -25,6 +25,9 @@
 
 #include <bugspray/bugspray.hpp>
 
+#include <algorithm>
+#include <array>
+
 TEST_CASE("inplace_vector - write access", "[container][inplace_vector]")
 {
     using namespace structural;
@@ -190,5 +193,26 @@ TEST_CASE("inplace_vector - write access", "[container][inplace_vector]")
                     }
                 });
         });
+
+    SECTION("insert & emplace keep order")
+    {
+        inplace_vector<int, C> sv{1, 2, 3};
+        sv.emplace(sv.begin() + 1, 10);
+        REQUIRE(std::ranges::equal(sv, std::array{1, 10, 2, 3}));
+        sv.insert(sv.begin() + 1, {20, 21, 22});
+        REQUIRE(std::ranges::equal(sv, std::array{1, 20, 21, 22, 10, 2, 3}));
+        sv.insert(sv.end() - 1, {30, 31});
+        REQUIRE(std::ranges::equal(sv, std::array{1, 20, 21, 22, 10, 2, 30, 31, 3}));
+        sv.emplace(sv.begin(), sv.back());
+        REQUIRE(std::ranges::equal(sv, std::array{3, 1, 20, 21, 22, 10, 2, 30, 31, 3}));
+    }
+    SECTION("insert & emplace keep order of non-trivial elements")
+    {
+        inplace_vector<bs::string, C> sv{"a", "b"};
+        sv.emplace(sv.begin(), "c");
+        sv.insert(sv.begin() + 1, {"d", "e", "f"});
+        sv.emplace(sv.begin() + 2, sv.front());
+        REQUIRE(sv == inplace_vector<bs::string, C>{"c", "d", "c", "e", "f", "a", "b"});
+    }
 }
 EVAL_TEST_CASE("inplace_vector - write access");
\ No newline at end of file
@@ -0,0 +1,129 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/ascii_case_insensitive.hpp"
+#include "structural/concept_structural_type_value.hpp"
+#include "structural/inplace_string.hpp"
+#include "structural/inplace_unordered_map.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <array>
+#include <compare>
+#include <string_view>
+
+namespace
+{
+constexpr std::array<std::string_view, 8> header_names{
+    "", "Host", "ACCEPT", "content-type", "Content-Length", "X-Forwarded-For", "Sec-WebSocket-Extensions", "@[`{"};
+
+constexpr auto swap_case(std::string_view sv) -> structural::inplace_string<32>
+{
+    structural::inplace_string<32> result;
+    for (char c : sv)
+    {
+        if (c >= 'a' && c <= 'z')
+            c = static_cast<char>(c - 'a' + 'A');
+        else if (c >= 'A' && c <= 'Z')
+            c = static_cast<char>(c - 'A' + 'a');
+        result.push_back(c);
+    }
+    return result;
+}
+} // namespace
+
+TEST_CASE("ascii_case_insensitive", "[container][inplace_string]")
+{
+    using namespace structural;
+
+    SECTION("ascii_ci_traits")
+    {
+        inplace_ci_string<32> const str = "Content-Type";
+        CHECK(str == "content-type");
+        CHECK(str == inplace_ci_string<32>("CONTENT-TYPE"));
+        CHECK(str != "Content-Typo");
+        CHECK((str <=> "CONTENT-TYPE") == std::weak_ordering::equivalent);
+        CHECK((str <=> "content-typf") == std::weak_ordering::less);
+        CHECK((str <=> "CONTENT") == std::weak_ordering::greater);
+        CHECK(str.find('t') == 3);
+        CHECK(str.find("TYPE") == 8);
+        CHECK(str.starts_with("content"));
+    }
+    SECTION("ascii_ci_equal")
+    {
+        ascii_ci_equal const equal;
+        for (auto name : header_names)
+        {
+            CHECK(equal(name, name));
+            CHECK(equal(name, swap_case(name)));
+            CHECK(equal(swap_case(name), inplace_ci_string<32>(name.data(), name.size())));
+        }
+        CHECK(!equal("Host", "Hosts"));
+        CHECK(!equal("@", "`"));
+        CHECK(!equal("[", "{"));
+        CHECK(!equal("\xc1", "\xe1"));
+        CHECK(!equal("Sec-WebSocket-Extensions", "Sec-WebSocket-Extension_"));
+    }
+    SECTION("ascii_ci_hash")
+    {
+        ascii_ci_hash const hash;
+        for (auto name : header_names)
+        {
+            CHECK(hash(name) == hash(swap_case(name)));
+            CHECK(hash(name) == structural::hash<inplace_ci_string<32>>{}(name));
+        }
+        CHECK(hash("Content-Length") != hash("Content-Lengths"));
+        CHECK(hash("X-Forwarded-For") != hash("X-Forwarded-Fox"));
+    }
+    SECTION("transparent lookup")
+    {
+        inplace_unordered_map<inplace_string<32>, int, 8, ascii_ci_hash, ascii_ci_equal> const headers{
+            {"Host", 1},
+            {"Accept", 2},
+            {"Content-Type", 3},
+        };
+        CHECK(headers.find(std::string_view("content-type"))->second == 3);
+        CHECK(headers.contains("HOST"));
+        CHECK(headers.contains(inplace_string<8>("accept")));
+        CHECK(!headers.contains("Content-Length"));
+    }
+    SECTION("default hash for inplace_ci_string")
+    {
+        inplace_unordered_map<inplace_ci_string<32>, int, 8> const headers{{"Host", 1}, {"Accept", 2}};
+        CHECK(headers.at("host") == 1);
+        CHECK(headers.at("ACCEPT") == 2);
+    }
+    SECTION("hash agrees between compile time and run time", runtime)
+    {
+        constexpr auto compile_time = ascii_ci_hash{}(std::string_view("Sec-WebSocket-Extensions"));
+        std::string_view const name = header_names[6];
+        CHECK(ascii_ci_hash{}(name) == compile_time);
+    }
+    SECTION("structural")
+    {
+        CHECK(structural_type<inplace_ci_string<16>>);
+        CHECK(structural_value<inplace_ci_string<16>("Host")>);
+    }
+}
+EVAL_TEST_CASE("ascii_case_insensitive");
@@ -0,0 +1,187 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/atomic_bitset.hpp"
+#include "structural/atomic_named_bitset.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <cstddef>
+
+STRUCTURAL_MAKE_NAMED_BITSET(feature_bits, features, logging, tracing, caching, compression)
+
+namespace
+{
+constexpr std::size_t thread_count = 4;
+
+// Lets several threads claim slots until none are left and returns how often each slot was claimed
+template<std::size_t N>
+auto claim_concurrently() -> std::vector<int>
+{
+    auto slots = std::make_unique<structural::atomic_bitset<N>>();
+
+    std::array<std::vector<std::size_t>, thread_count> claimed;
+    std::vector<std::thread>                           threads;
+    for (std::size_t t = 0; t < thread_count; ++t)
+        threads.emplace_back(
+            [&, t]
+            {
+                for (auto pos = slots->find_first_unset_and_set(); pos != slots->npos;
+                     pos      = slots->find_first_unset_and_set())
+                    claimed[t].push_back(pos);
+            });
+    for (auto& thread : threads)
+        thread.join();
+
+    std::vector<int> counts(N);
+    for (auto const& positions : claimed)
+        for (auto pos : positions)
+            ++counts[pos];
+    return counts;
+}
+
+// Lets every thread set and reset its own bits of a shared set and returns the resulting snapshot
+template<std::size_t N>
+auto set_concurrently() -> structural::bitset<N>
+{
+    auto bits = std::make_unique<structural::atomic_bitset<N>>();
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < thread_count; ++t)
+        threads.emplace_back(
+            [&, t]
+            {
+                for (int round = 0; round < 100; ++round)
+                    for (std::size_t pos = t; pos < N; pos += thread_count)
+                    {
+                        bits->set(pos);
+                        if (pos % 3 == 0)
+                            bits->reset(pos);
+                    }
+            });
+    for (auto& thread : threads)
+        thread.join();
+    return bits->snapshot();
+}
+} // namespace
+
+TEST_CASE("atomic_bitset", "[container][atomic_bitset]")
+{
+    using namespace structural;
+
+    SECTION("single thread", runtime)
+    {
+        atomic_bitset<130> bits;
+        CHECK(bits.snapshot().none());
+
+        bits.set(3);
+        bits.set(129);
+        CHECK(bits.test(3));
+        CHECK(bits.test(129));
+        CHECK(!bits.test(4));
+        CHECK(bits.snapshot().count() == 2);
+
+        CHECK(bits.test_and_set(3));
+        CHECK(!bits.test_and_set(4));
+        CHECK(bits.test_and_reset(4));
+        CHECK(!bits.test_and_reset(4));
+
+        bits.reset(3);
+        bits.flip(64);
+        CHECK(!bits.test(3));
+        CHECK(bits.test(64));
+    }
+
+    SECTION("conversion", runtime)
+    {
+        auto const        mask = bitset<70>{0b1011u} | (bitset<70>{1u} << 69u);
+        atomic_bitset<70> bits{mask};
+        CHECK(bits.snapshot() == mask);
+        CHECK(static_cast<bitset<70>>(bits) == mask);
+
+        bits.store(bitset<70>{0b1u});
+        CHECK(bits.snapshot() == bitset<70>{0b1u});
+    }
+
+    SECTION("masks", runtime)
+    {
+        atomic_bitset<70> bits{bitset<70>{0b0110u}};
+        CHECK(bits.fetch_set(bitset<70>{0b1100u} | (bitset<70>{1u} << 69u)) == bitset<70>{0b0110u});
+        CHECK(bits.snapshot() == (bitset<70>{0b1110u} | (bitset<70>{1u} << 69u)));
+        CHECK(bits.fetch_reset(bitset<70>{0b0011u}) == (bitset<70>{0b1110u} | (bitset<70>{1u} << 69u)));
+        CHECK(bits.snapshot() == (bitset<70>{0b1100u} | (bitset<70>{1u} << 69u)));
+    }
+
+    SECTION("find_first_unset_and_set", runtime)
+    {
+        atomic_bitset<70> bits{bitset<70>{0b1011u}};
+        CHECK(bits.find_first_unset_and_set() == 2);
+        CHECK(bits.find_first_unset_and_set() == 4);
+        bits.store(bitset<70>{}.set().reset(66));
+        CHECK(bits.find_first_unset_and_set() == 66);
+        CHECK(bits.find_first_unset_and_set() == bits.npos);
+    }
+
+    SECTION("multiple threads", runtime)
+    {
+        CHECK(std::ranges::all_of(claim_concurrently<13>(), [](int n) { return n == 1; }));
+        CHECK(std::ranges::all_of(claim_concurrently<1000>(), [](int n) { return n == 1; }));
+
+        auto const bits = set_concurrently<1000>();
+        for (std::size_t pos = 0; pos < 1000; ++pos)
+            CHECK(bits.test(pos) == (pos % 3 != 0));
+    }
+}
+
+TEST_CASE("atomic_named_bitset", "[container][atomic_named_bitset]")
+{
+    using namespace structural;
+    using enum feature_bits;
+
+    SECTION("flags", runtime)
+    {
+        atomic_named_bitset<feature_bits, features_size> flags{logging | caching};
+        CHECK(flags.test(logging));
+        CHECK(!flags.test(tracing));
+
+        CHECK(!flags.test_and_set(tracing));
+        CHECK(flags.test_and_reset(logging));
+        flags.flip(compression);
+        CHECK(flags.snapshot() == (tracing | caching | compression));
+
+        CHECK(flags.fetch_reset(caching | compression) == (tracing | caching | compression));
+        CHECK(flags.fetch_set(logging) == features{tracing});
+        CHECK(static_cast<features>(flags) == (logging | tracing));
+
+        CHECK(flags.find_first_unset_and_set() == caching);
+        CHECK(flags.find_first_unset_and_set() == compression);
+        CHECK(flags.find_first_unset_and_set() == std::nullopt);
+    }
+}
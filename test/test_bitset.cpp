@@ -27,6 +27,77 @@
 
 #include <bugspray/bugspray.hpp>
 
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <random>
+#include <ranges>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+template<std::size_t N, typename Chunk>
+void check_against_std_bitset(std::mt19937& rng)
+{
+    auto const random_bits = [&]()
+    {
+        std::pair<structural::bitset<N, Chunk>, std::bitset<N>> result;
+        for (std::size_t i = 0; i < N; ++i)
+            if (rng() % 2)
+            {
+                result.first.set(i);
+                result.second.set(i);
+            }
+        return result;
+    };
+    auto const same = [](structural::bitset<N, Chunk> const& lhs, std::bitset<N> const& rhs)
+    { return lhs.to_string() == rhs.to_string() && lhs.count() == rhs.count(); };
+
+    for (int round = 0; round < 20; ++round)
+    {
+        auto const [a, std_a] = random_bits();
+        auto const [b, std_b] = random_bits();
+        std::size_t const pos = rng() % (N + 70);
+
+        CHECK(same(a & b, std_a & std_b));
+        CHECK(same(a | b, std_a | std_b));
+        CHECK(same(a ^ b, std_a ^ std_b));
+        CHECK(same(~a, ~std_a));
+        CHECK(same(a << pos, std_a << pos));
+        CHECK(same(a >> pos, std_a >> pos));
+        CHECK(same(a << (pos % 64), std_a << (pos % 64)));
+        CHECK(same(a >> (pos % 64), std_a >> (pos % 64)));
+        CHECK(a.all() == std_a.all());
+        CHECK(a.any() == std_a.any());
+
+        std::size_t expected = 0;
+        for (auto i : a.set_bits())
+        {
+            while (!std_a.test(expected))
+                ++expected;
+            CHECK(i == expected++);
+        }
+        CHECK(std::ranges::distance(a.set_bits()) == std::ptrdiff_t(std_a.count()));
+
+        std::size_t reverse_count = 0;
+        for (auto i = a.find_prev(N); i != a.npos; i = a.find_prev(i))
+        {
+            CHECK(std_a.test(i));
+            ++reverse_count;
+        }
+        CHECK(reverse_count == std_a.count());
+
+        CHECK(a.to_string() == std_a.to_string());
+        CHECK(a.to_inplace_string() == std_a.to_string());
+        CHECK((structural::bitset<N, Chunk>{std_a.to_string()}) == a);
+        CHECK((structural::bitset<N, Chunk>{std_a.to_string('.', 'x'), '.', 'x'}) == a);
+    }
+}
+} // namespace
+
 TEST_CASE("bitset")
 {
     using namespace structural;
@@ -48,9 +119,20 @@ TEST_CASE("bitset")
         SECTION("from string")
         {
             CHECK(bitset<9>{"110110101"} == bitset<9>{0b110110101u});
+            CHECK(bitset<9>{"1101"} == bitset<9>{0b110100000u});
+            CHECK(bitset<20, std::uint8_t>{"10000001111111100101"}
+                  == bitset<20, std::uint8_t>{0b10000001111111100101u});
+            CHECK(bitset<20>{"10000001111111100101"} == bitset<20>{0b10000001111111100101u});
+            CHECK(bitset<20>{"x....xxxxxxxx..x.x", '.', 'x'} == bitset<20>{0b10000111111110010100u});
+            CHECK(bitset<20>{std::u8string_view{u8"10000001111111100101"}, u8'0', u8'1'}
+                  == bitset<20>{0b10000001111111100101u});
+            CHECK(bitset<20>{std::u32string_view{U"10000001111111100101"}, U'0', U'1'}
+                  == bitset<20>{0b10000001111111100101u});
             SECTION("exceptions", runtime)
             {
                 REQUIRE_THROWS_AS(std::invalid_argument, bitset<9>{"1234"});
+                REQUIRE_THROWS_AS(std::invalid_argument, bitset<20>{"1000000111111110x101"});
+                REQUIRE_THROWS_AS(std::invalid_argument, bitset<20>{"10000001211111100101"});
             }
         }
     }
@@ -151,10 +233,109 @@ TEST_CASE("bitset")
         }
     }
 
+    SECTION("chunk type")
+    {
+        CHECK(std::is_same_v<bitset<8>::chunk_t, std::uint8_t>);
+        CHECK(std::is_same_v<bitset<16>::chunk_t, std::uint16_t>);
+        CHECK(std::is_same_v<bitset<32>::chunk_t, std::uint32_t>);
+        CHECK(std::is_same_v<bitset<33>::chunk_t, std::uint64_t>);
+        CHECK(std::is_same_v<bitset<4096>::chunk_t, std::uint64_t>);
+        CHECK(sizeof(bitset<130>) == 3 * sizeof(std::uint64_t));
+        CHECK(sizeof(bitset<130, std::uint8_t>) == 17);
+
+        CHECK(bitset<20, std::uint8_t>{0xfabcdu} == bitset<20, std::uint8_t>{"11111010101111001101"});
+        CHECK(bitset<20, std::uint8_t>{0xfabcdu}.to_ullong() == 0xfabcdu);
+        CHECK(bitset<20, std::uint8_t>{0xfabcdu}.count() == bitset<20>{0xfabcdu}.count());
+    }
+    SECTION("bulk operations on multiple words")
+    {
+        bitset<130> multi;
+        multi.set();
+        CHECK(multi.all());
+        CHECK(multi.count() == 130);
+        multi.reset(129);
+        CHECK(!multi.all());
+        CHECK(multi.count() == 129);
+        multi.flip();
+        CHECK(multi.any());
+        CHECK(multi.count() == 1);
+        CHECK(multi.test(129));
+        CHECK((~multi).count() == 129);
+        multi.reset();
+        CHECK(multi.none());
+        CHECK(bitset<9>{0xffffu}.count() == 9);
+        CHECK(bitset<130>{~0ull}.count() == 64);
+    }
+
+    SECTION("find")
+    {
+        bitset<200> sparse;
+        CHECK(sparse.find_first() == sparse.npos);
+        CHECK(sparse.find_last() == sparse.npos);
+        CHECK(sparse.find_next(0) == sparse.npos);
+        CHECK(sparse.find_prev(200) == sparse.npos);
+
+        sparse.set(3).set(64).set(65).set(199);
+        CHECK(sparse.find_first() == 3);
+        CHECK(sparse.find_last() == 199);
+        CHECK(sparse.find_next(0) == 3);
+        CHECK(sparse.find_next(3) == 64);
+        CHECK(sparse.find_next(64) == 65);
+        CHECK(sparse.find_next(65) == 199);
+        CHECK(sparse.find_next(199) == sparse.npos);
+        CHECK(sparse.find_next(1000) == sparse.npos);
+        CHECK(sparse.find_prev(1000) == 199);
+        CHECK(sparse.find_prev(199) == 65);
+        CHECK(sparse.find_prev(65) == 64);
+        CHECK(sparse.find_prev(64) == 3);
+        CHECK(sparse.find_prev(3) == sparse.npos);
+        CHECK(sparse.find_prev(0) == sparse.npos);
+
+        CHECK((1000'0001_bits).find_first() == 0);
+        CHECK((1000'0001_bits).find_next(0) == 7);
+        CHECK((1000'0001_bits).find_last() == 7);
+        CHECK((1000'0001_bits).find_prev(7) == 0);
+        CHECK((bitset<20, std::uint8_t>{0b1000'0000'0000'1000'0001u}).find_prev(19) == 7);
+    }
+    SECTION("set_bits")
+    {
+        bitset<200> sparse;
+        CHECK(std::ranges::empty(sparse.set_bits()));
+
+        sparse.set(3).set(64).set(65).set(199);
+        std::array<std::size_t, 4> indices{};
+        std::ranges::copy(sparse.set_bits(), indices.begin());
+        CHECK(indices == std::array<std::size_t, 4>{3, 64, 65, 199});
+        CHECK(std::ranges::distance(sparse.set_bits()) == 4);
+    }
+    SECTION("for_each_set")
+    {
+        bitset<200> sparse;
+        sparse.set(3).set(64).set(65).set(199);
+        std::array<std::size_t, 4> indices{};
+        std::size_t                n = 0;
+        sparse.for_each_set([&](std::size_t i) { indices[n++] = i; });
+        CHECK(n == 4);
+        CHECK(indices == std::array<std::size_t, 4>{3, 64, 65, 199});
+    }
+
     SECTION("to_string", runtime) // TODO: Check at compile time once gcc supports constexpr string properly
     {
         CHECK((100100110_bits).to_string() == "100100110");
         CHECK((100100110_bits).to_string(' ', 'x') == "x  x  xx ");
+        CHECK(bitset<20>{0b10000001111111100101u}.to_string() == "10000001111111100101");
+        CHECK(bitset<20>{0b10000001111111100101u}.to_string<wchar_t>() == L"10000001111111100101");
+    }
+    SECTION("to_inplace_string")
+    {
+        CHECK((100100110_bits).to_inplace_string() == "100100110");
+        CHECK((100100110_bits).to_inplace_string(' ', 'x') == "x  x  xx ");
+        CHECK(bitset<20>{0b10000001111111100101u}.to_inplace_string() == "10000001111111100101");
+        CHECK(bitset<20, std::uint8_t>{0b10000001111111100101u}.to_inplace_string() == "10000001111111100101");
+        CHECK(bitset<20>{0b10000001111111100101u}.to_inplace_string<char32_t>() == U"10000001111111100101");
+        constexpr std::string_view long_str = "1000000000000000000000000000000000000000000000000000000000000000101101";
+        CHECK(bitset<70>{long_str}.to_inplace_string() == long_str);
+        CHECK(bitset<70, std::uint8_t>{long_str}.to_inplace_string() == long_str);
     }
     SECTION("to_ulong")
     {
@@ -193,11 +374,36 @@ TEST_CASE("bitset")
     {
         CHECK((1'1011'0111_bits << 3u) == 1'1011'1000_bits);
         CHECK((110'1101'1100'1001_bits << 3u) == 110'1110'0100'1000_bits);
+        CHECK((1011'0111_bits << 1u) == 0110'1110_bits);
+        CHECK((1011'0111_bits << 0u) == 1011'0111_bits);
+        CHECK((1011'0111_bits << 8u) == 0000'0000_bits);
+        CHECK((bitset<200>{0b101u} << 130u).count() == 2);
+        CHECK((bitset<200>{0b101u} << 130u).test(132));
+        CHECK((bitset<200>{0b101u} << 198u).count() == 1);
+        CHECK(((bitset<200>{0b101u} << 137u) >> 137u) == bitset<200>{0b101u});
     }
     SECTION("operator>>")
     {
         CHECK((1'1011'0111_bits >> 3u) == 0'0011'0110_bits);
         CHECK((110'1101'1100'1001_bits >> 3u) == 000'1101'1011'1001_bits);
+        CHECK((110'1101'1100'1001_bits >> 12u) == 000'0000'0000'0110_bits);
+        CHECK((110'1101'1100'1001_bits >> 15u) == 000'0000'0000'0000_bits);
+        CHECK((bitset<200>{}.set(199) >> 199u) == bitset<200>{1u});
+        CHECK((bitset<200>{}.set(199) >> 64u).test(135));
+    }
+
+    SECTION("differential against std::bitset", runtime)
+    {
+        std::mt19937 rng(42);
+        check_against_std_bitset<1, std::uint8_t>(rng);
+        check_against_std_bitset<7, std::uint8_t>(rng);
+        check_against_std_bitset<64, std::uint64_t>(rng);
+        check_against_std_bitset<65, std::uint64_t>(rng);
+        check_against_std_bitset<130, std::uint8_t>(rng);
+        check_against_std_bitset<130, std::uint64_t>(rng);
+        check_against_std_bitset<1000, std::uint32_t>(rng);
+        check_against_std_bitset<1000, std::uint64_t>(rng);
+        check_against_std_bitset<4096, std::uint64_t>(rng);
     }
 
     SECTION("std::hash")
@@ -0,0 +1,144 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/concept_structural_type_value.hpp"
+#include "structural/hierarchical_bitset.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <ranges>
+#include <set>
+
+#include <cstddef>
+
+TEST_CASE("hierarchical_bitset")
+{
+    using namespace structural;
+
+    hierarchical_bitset<10000> bs;
+    SECTION("default constructor")
+    {
+        CHECK(!bs.all());
+        CHECK(!bs.any());
+        CHECK(bs.none());
+        CHECK(bs.count() == 0);
+        CHECK(bs.find_first() == bs.npos);
+        CHECK(bs.find_last() == bs.npos);
+        CHECK(std::ranges::empty(bs.set_bits()));
+    }
+    SECTION("set and reset")
+    {
+        bs.set(5).set(7000).set(7001).set(9999);
+        CHECK(bs.any());
+        CHECK(bs.count() == 4);
+        CHECK(bs.test(7000));
+        CHECK(!bs.test(6999));
+        CHECK(bs.summary.count() == 3);
+
+        bs.reset(7000);
+        CHECK(bs.summary.count() == 3);
+        bs.reset(7001);
+        CHECK(bs.summary.count() == 2);
+        bs.flip(5).flip(9999);
+        CHECK(bs.none());
+        CHECK(bs.summary.none());
+    }
+    SECTION("setting all")
+    {
+        bs.set();
+        CHECK(bs.all());
+        CHECK(bs.count() == 10000);
+        bs.reset(4711);
+        CHECK(!bs.all());
+        CHECK(bs.find_first() == 0);
+        CHECK(bs.find_next(4710) == 4712);
+        CHECK(bs.find_last() == 9999);
+        bs.reset();
+        CHECK(bs.none());
+    }
+    SECTION("find")
+    {
+        bs.set(5).set(7000).set(7001).set(9999);
+        CHECK(bs.find_first() == 5);
+        CHECK(bs.find_next(0) == 5);
+        CHECK(bs.find_next(5) == 7000);
+        CHECK(bs.find_next(7000) == 7001);
+        CHECK(bs.find_next(7001) == 9999);
+        CHECK(bs.find_next(9999) == bs.npos);
+        CHECK(bs.find_last() == 9999);
+    }
+    SECTION("iteration")
+    {
+        bs.set(5).set(7000).set(7001).set(9999);
+        std::array<std::size_t, 4> indices{};
+        std::ranges::copy(bs.set_bits(), indices.begin());
+        CHECK(indices == std::array<std::size_t, 4>{5, 7000, 7001, 9999});
+
+        std::size_t n = 0;
+        bs.for_each_set([&](std::size_t i) { CHECK(indices[n++] == i); });
+        CHECK(n == 4);
+    }
+    SECTION("conversion")
+    {
+        bitset<130> flat;
+        flat.set(1).set(64).set(129);
+        hierarchical_bitset<130> const sparse{flat};
+        CHECK(sparse.count() == 3);
+        CHECK(sparse.to_bitset() == flat);
+    }
+    SECTION("differential against std::set", runtime)
+    {
+        std::mt19937               rng(42);
+        std::set<std::size_t>      reference;
+        hierarchical_bitset<20000> sparse;
+        for (int i = 0; i < 2000; ++i)
+        {
+            auto const pos = rng() % sparse.size();
+            if (rng() % 3 == 0)
+            {
+                sparse.reset(pos);
+                reference.erase(pos);
+            }
+            else
+            {
+                sparse.set(pos);
+                reference.insert(pos);
+            }
+        }
+        CHECK(sparse.count() == reference.size());
+        CHECK(std::ranges::equal(sparse.set_bits(), reference));
+        for (auto pos : reference)
+            CHECK(sparse.find_next(pos) == (pos == *reference.rbegin() ? sparse.npos : *reference.upper_bound(pos)));
+    }
+    SECTION("structural")
+    {
+        constexpr auto sparse = hierarchical_bitset<5000>{}.set(7).set(4999);
+        CHECK(structural_value<sparse>);
+    }
+}
+
+EVAL_TEST_CASE("hierarchical_bitset");
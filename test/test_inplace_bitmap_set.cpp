@@ -0,0 +1,192 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "structural/concept_structural_type_value.hpp"
+#include "structural/inplace_bitmap_set.hpp"
+#include "structural/inplace_set.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <random>
+
+#include <cstddef>
+#include <cstdint>
+
+TEST_CASE("inplace_bitmap_set", "[container]")
+{
+    using namespace structural;
+
+    static_assert(std::bidirectional_iterator<inplace_bitmap_set<int, 10>::const_iterator>);
+
+    inplace_bitmap_set<int, 200> s{3, 64, 65, 199};
+
+    SECTION("construction")
+    {
+        CHECK(inplace_bitmap_set<int, 10>{}.empty());
+        CHECK(inplace_bitmap_set<int, 10>{}.size() == 0);
+        CHECK(inplace_bitmap_set<int, 10>::capacity() == 11);
+        CHECK(s.size() == 4);
+
+        std::array const data = {5, 1, 5, 9};
+        CHECK((inplace_bitmap_set<int, 10>{data.begin(), data.end()}) == (inplace_bitmap_set<int, 10>{1, 5, 9}));
+
+        inplace_bitmap_set<int, 10> assigned{1, 2};
+        assigned = {3, 4, 5};
+        CHECK(assigned == (inplace_bitmap_set<int, 10>{3, 4, 5}));
+    }
+    SECTION("insert")
+    {
+        CHECK(*s.insert(100) == 100);
+        CHECK(*s.insert(100) == 100);
+        CHECK(*s.emplace(0) == 0);
+        CHECK(s.size() == 6);
+        s.insert({7, 8});
+        CHECK(s.size() == 8);
+        CHECK(s.contains(7));
+        CHECK(s.contains(8));
+    }
+    SECTION("find")
+    {
+        CHECK(s.contains(3));
+        CHECK(s.contains(199));
+        CHECK(!s.contains(4));
+        CHECK(!s.contains(-1));
+        CHECK(!s.contains(201));
+        CHECK(s.count(64) == 1);
+        CHECK(s.count(63) == 0);
+        CHECK(*s.find(65) == 65);
+        CHECK(s.find(66) == s.end());
+        CHECK(s.find(1000) == s.end());
+    }
+    SECTION("erase")
+    {
+        CHECK(s.erase(64) == 1);
+        CHECK(s.erase(64) == 0);
+        CHECK(s.erase(-5) == 0);
+        CHECK(*s.erase(s.find(3)) == 65);
+        CHECK(s.erase(s.find(199)) == s.end());
+        CHECK(s.size() == 1);
+
+        s = {1, 2, 3, 4, 5};
+        CHECK(*s.erase(s.find(2), s.find(5)) == 5);
+        CHECK(s == (inplace_bitmap_set<int, 200>{1, 5}));
+
+        s = {1, 2, 3, 4, 5};
+        CHECK(erase_if(s, [](int i) { return i % 2 == 0; }) == 2);
+        CHECK(s == (inplace_bitmap_set<int, 200>{1, 3, 5}));
+
+        s.clear();
+        CHECK(s.empty());
+    }
+    SECTION("iteration")
+    {
+        std::array<int, 4> values{};
+        std::ranges::copy(s, values.begin());
+        CHECK(values == std::array{3, 64, 65, 199});
+
+        std::ranges::copy(s.rbegin(), s.rend(), values.begin());
+        CHECK(values == std::array{199, 65, 64, 3});
+
+        auto iter = s.end();
+        CHECK(*--iter == 199);
+        CHECK(*iter-- == 199);
+        CHECK(*iter == 65);
+        CHECK(std::ranges::distance(s) == 4);
+        CHECK(inplace_bitmap_set<int, 10>{}.begin() == inplace_bitmap_set<int, 10>{}.end());
+    }
+    SECTION("lower_bound, upper_bound, equal_range")
+    {
+        CHECK(*s.lower_bound(-10) == 3);
+        CHECK(*s.lower_bound(0) == 3);
+        CHECK(*s.lower_bound(3) == 3);
+        CHECK(*s.lower_bound(4) == 64);
+        CHECK(*s.lower_bound(65) == 65);
+        CHECK(*s.lower_bound(199) == 199);
+        CHECK(s.lower_bound(200) == s.end());
+        CHECK(s.lower_bound(1000) == s.end());
+
+        CHECK(*s.upper_bound(-10) == 3);
+        CHECK(*s.upper_bound(3) == 64);
+        CHECK(*s.upper_bound(64) == 65);
+        CHECK(s.upper_bound(199) == s.end());
+        CHECK(s.upper_bound(1000) == s.end());
+
+        CHECK(get<0>(s.equal_range(64)) == s.find(64));
+        CHECK(get<1>(s.equal_range(64)) == s.find(65));
+        CHECK(get<0>(s.equal_range(10)) == get<1>(s.equal_range(10)));
+
+        inplace_bitmap_set<std::uint8_t, 255> full{0, 255};
+        CHECK(*full.lower_bound(0) == 0);
+        CHECK(*full.lower_bound(1) == 255);
+        CHECK(*full.upper_bound(0) == 255);
+        CHECK(full.upper_bound(255) == full.end());
+    }
+    SECTION("set operations")
+    {
+        inplace_bitmap_set<int, 200> const other{3, 4, 65, 100};
+
+        CHECK((s | other) == (inplace_bitmap_set<int, 200>{3, 4, 64, 65, 100, 199}));
+        CHECK((s & other) == (inplace_bitmap_set<int, 200>{3, 65}));
+        CHECK((s - other) == (inplace_bitmap_set<int, 200>{64, 199}));
+        CHECK((other - s) == (inplace_bitmap_set<int, 200>{4, 100}));
+        CHECK((s ^ other) == (inplace_bitmap_set<int, 200>{4, 64, 100, 199}));
+        CHECK((s - s).empty());
+        CHECK((s - inplace_bitmap_set<int, 200>{}) == s);
+    }
+    SECTION("against inplace_set", runtime)
+    {
+        std::mt19937                  rng(42);
+        inplace_bitmap_set<int, 1000> bitmap;
+        inplace_set<int, 1001>        tree;
+        for (int i = 0; i < 2000; ++i)
+        {
+            int const value = int(rng() % 1001);
+            if (rng() % 3 == 0)
+            {
+                CHECK(bitmap.erase(value) == tree.count(value));
+                if (tree.contains(value))
+                    tree.erase(tree.find(value));
+            }
+            else
+            {
+                bitmap.insert(value);
+                tree.insert(value);
+            }
+            CHECK(bitmap.size() == tree.size());
+            CHECK(bitmap.contains(value) == tree.contains(value));
+            CHECK((bitmap.lower_bound(value) == bitmap.end()) == (tree.lower_bound(value) == tree.end()));
+            if (tree.lower_bound(value) != tree.end())
+                CHECK(*bitmap.lower_bound(value) == *tree.lower_bound(value));
+        }
+        CHECK(std::ranges::equal(bitmap, tree));
+    }
+    SECTION("structural")
+    {
+        CHECK(structural_type<inplace_bitmap_set<int, 10>>);
+        CHECK(structural_value<inplace_bitmap_set<int, 10>{1, 2, 3}>);
+    }
+}
+EVAL_TEST_CASE("inplace_bitmap_set");
@@ -0,0 +1,131 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "structural/concept_structural_type_value.hpp"
+#include "structural/inplace_bloom_filter.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+template<typename Filter>
+constexpr void check_filter()
+{
+    Filter filter;
+    CHECK(filter.empty());
+    CHECK(!filter.might_contain(1));
+
+    filter.insert({1, 2, 3, 1000, -7});
+    CHECK(!filter.empty());
+    CHECK(filter.might_contain(1));
+    CHECK(filter.might_contain(2));
+    CHECK(filter.might_contain(3));
+    CHECK(filter.might_contain(1000));
+    CHECK(filter.might_contain(-7));
+
+    Filter other{42};
+    other |= filter;
+    CHECK(other.might_contain(42));
+    CHECK(other.might_contain(1000));
+
+    filter.clear();
+    CHECK(filter.empty());
+    CHECK(filter == Filter{});
+}
+
+// Inserts n keys and returns the fraction of 100000 other keys that the filter doesn't reject
+template<typename Filter>
+auto measured_false_positive_rate(std::uint32_t n) -> double
+{
+    auto* filter = new Filter;
+    for (std::uint32_t i = 0; i < n; ++i)
+        filter->insert(i);
+
+    std::size_t no_false_negatives = 0;
+    for (std::uint32_t i = 0; i < n; ++i)
+        no_false_negatives += filter->might_contain(i);
+    CHECK(no_false_negatives == n);
+
+    std::size_t false_positives = 0;
+    for (std::uint32_t i = n; i < n + 100'000; ++i)
+        false_positives += filter->might_contain(i);
+    delete filter;
+    return double(false_positives) / 100'000;
+}
+} // namespace
+
+TEST_CASE("inplace_bloom_filter", "[container]")
+{
+    using namespace structural;
+
+    SECTION("inplace_bloom_filter")
+    {
+        check_filter<inplace_bloom_filter<int, 1000, 5>>();
+        check_filter<inplace_bloom_filter<int, 64, 3>>();
+    }
+    SECTION("inplace_blocked_bloom_filter")
+    {
+        check_filter<inplace_blocked_bloom_filter<int, 1024>>();
+        check_filter<inplace_blocked_bloom_filter<int, 256, 3>>();
+    }
+    SECTION("false_positive_rate")
+    {
+        CHECK(inplace_bloom_filter<int, 1024, 4>::false_positive_rate(0) == 0);
+        CHECK(inplace_blocked_bloom_filter<int, 1024>::false_positive_rate(0) == 0);
+
+        // About 0.82% for 10 bits per key and K = 7
+        double const rate = inplace_bloom_filter<int, 10'000, 7>::false_positive_rate(1000);
+        CHECK(rate > 0.0080 && rate < 0.0084);
+
+        double const blocked_rate = inplace_blocked_bloom_filter<int, 10'240, 8>::false_positive_rate(1000);
+        CHECK(blocked_rate > rate);
+        CHECK(blocked_rate < 2 * rate);
+        CHECK(inplace_blocked_bloom_filter<int, 256>::false_positive_rate(1'000'000) > 0.99);
+    }
+    SECTION("measured false positive rate", runtime)
+    {
+        using classic = inplace_bloom_filter<std::uint32_t, 16384, 7>;
+        using blocked = inplace_blocked_bloom_filter<std::uint32_t, 16384, 8>;
+
+        CHECK(measured_false_positive_rate<classic>(1000) < 2 * classic::false_positive_rate(1000));
+        CHECK(measured_false_positive_rate<blocked>(1000) < 2 * blocked::false_positive_rate(1000));
+        CHECK(measured_false_positive_rate<blocked>(100) < 2 * blocked::false_positive_rate(100));
+    }
+    SECTION("built at compile time", runtime)
+    {
+        constexpr inplace_blocked_bloom_filter<int, 1024> static_filter{1, 2, 3, 1000};
+
+        inplace_blocked_bloom_filter<int, 1024> filter{1, 2, 3, 1000};
+        CHECK(filter == static_filter);
+    }
+    SECTION("structural")
+    {
+        CHECK(structural_type<inplace_bloom_filter<int, 100, 3>>);
+        CHECK(structural_value<inplace_bloom_filter<int, 100, 3>{1, 2}>);
+        CHECK(structural_value<inplace_blocked_bloom_filter<int, 512>{1, 2}>);
+    }
+}
+EVAL_TEST_CASE("inplace_bloom_filter");
@@ -0,0 +1,169 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/inplace_format.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string_view>
+
+namespace
+{
+// Checks that the constant-evaluable float formatting agrees with std::to_chars
+template<typename T, typename Bits>
+auto agrees_with_to_chars(std::size_t iterations) -> bool
+{
+    std::mt19937_64 rng(42);
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        T const value = std::bit_cast<T>(static_cast<Bits>(rng()));
+        char    expected[64];
+        char    actual[64];
+        auto const expected_last = std::to_chars(expected, expected + 64, value).ptr;
+        auto const actual_last   = structural::detail::write_shortest(actual, value);
+        if (std::string_view(expected, expected_last) != std::string_view(actual, actual_last))
+            return false;
+    }
+    return true;
+}
+} // namespace
+
+TEST_CASE("inplace_format", "[container][inplace_string]")
+{
+    using namespace structural;
+
+    SECTION("max_formatted_size")
+    {
+        CHECK(max_formatted_size<std::int8_t> == 4);
+        CHECK(max_formatted_size<std::uint8_t> == 3);
+        CHECK(max_formatted_size<std::int32_t> == 11);
+        CHECK(max_formatted_size<std::uint32_t> == 10);
+        CHECK(max_formatted_size<std::int64_t> == 20);
+        CHECK(max_formatted_size<std::uint64_t> == 20);
+        CHECK(max_formatted_size<float> == 15);
+        CHECK(max_formatted_size<double> == 24);
+    }
+    SECTION("append_int")
+    {
+        inplace_string<64> str = "x=";
+        append_int(str, 0);
+        CHECK(str == "x=0");
+        append_int(str, -42);
+        CHECK(str == "x=0-42");
+        str.clear();
+        append_int(str, std::numeric_limits<std::int64_t>::min());
+        CHECK(str == "-9223372036854775808");
+        str.clear();
+        append_int(str, std::numeric_limits<std::uint64_t>::max());
+        CHECK(str == "18446744073709551615");
+        str.clear();
+        append_int(str, std::int8_t{-128});
+        CHECK(str == "-128");
+        CHECK(str.c_str()[str.size()] == '\0');
+    }
+    SECTION("append_int without room for the worst case")
+    {
+        inplace_string<5> str = "ab";
+        append_int(str, 123u);
+        CHECK(str == "ab123");
+    }
+    SECTION("append_int to wide strings")
+    {
+        inplace_u32string<8> str = U"n=";
+        append_int(str, -7);
+        CHECK(str == U"n=-7");
+    }
+    SECTION("append_float")
+    {
+        inplace_string<64> str;
+        append_float(str, 0.1);
+        CHECK(str == "0.1");
+        str.clear();
+        append_float(str, -1.5f);
+        CHECK(str == "-1.5");
+        str.clear();
+        append_float(str, 1e16);
+        CHECK(str == "1e+16");
+        str.clear();
+        append_float(str, 1e-4);
+        CHECK(str == "1e-04");
+        str.clear();
+        append_float(str, 123456.789);
+        CHECK(str == "123456.789");
+        str.clear();
+        append_float(str, 12345678901234567890.0);
+        CHECK(str == "12345678901234567168");
+        str.clear();
+        append_float(str, 5e-324);
+        CHECK(str == "5e-324");
+        str.clear();
+        append_float(str, -2.2250738585072014e-308);
+        CHECK(str == "-2.2250738585072014e-308");
+        str.clear();
+        append_float(str, -0.0);
+        CHECK(str == "-0");
+        str.clear();
+        append_float(str, -std::numeric_limits<double>::infinity());
+        CHECK(str == "-inf");
+    }
+    SECTION("append_float agrees with std::to_chars", runtime)
+    {
+        CHECK(agrees_with_to_chars<double, std::uint64_t>(100000));
+        CHECK(agrees_with_to_chars<float, std::uint32_t>(100000));
+    }
+    SECTION("to_inplace_string")
+    {
+        auto const i = to_inplace_string(-1234);
+        CHECK(i == "-1234");
+        CHECK(i.capacity() == max_formatted_size<int>);
+
+        auto const d = to_inplace_string(2.5);
+        CHECK(d == "2.5");
+        CHECK(d.capacity() == max_formatted_size<double>);
+
+        auto const small = to_inplace_string<3>(255u);
+        CHECK(small == "255");
+        CHECK(small.capacity() == 3);
+    }
+    SECTION("inplace_format")
+    {
+        CHECK(inplace_format<32>("{} + {} = {}", 1, 2.5, 3.5f) == "1 + 2.5 = 3.5");
+        CHECK(inplace_format<32>("{{{}}}", 'x') == "{x}");
+        CHECK(inplace_format<32>("{}{}", true, false) == "truefalse");
+        CHECK(inplace_format<32>("no placeholders") == "no placeholders");
+        CHECK(inplace_format<32>("[{}]", std::string_view("sv")) == "[sv]");
+        CHECK(inplace_format<32>("{}: {}", "key", inplace_string<8>("value")) == "key: value");
+    }
+    SECTION("append_format")
+    {
+        inplace_string<64> str = "metric";
+        append_format(str, "{{host={}}} {} {}", "a", 17, 0.25);
+        CHECK(str == "metric{host=a} 17 0.25");
+    }
+}
+EVAL_TEST_CASE("inplace_format");
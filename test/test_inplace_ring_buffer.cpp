@@ -0,0 +1,156 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/concept_structural_type_value.hpp"
+#include "structural/inplace_ring_buffer.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+
+TEST_CASE("inplace_ring_buffer", "[container][inplace_ring_buffer]")
+{
+    using namespace structural;
+
+    bs::static_for_each_type<inplace_ring_buffer<int, 4>, inplace_ring_buffer<int, 5>>(
+        [&]<typename test_type>
+        {
+            DYNAMIC_SECTION(bs::stringify_typename<test_type>())
+            {
+                SECTION("random access iterators")
+                {
+                    CHECK(std::random_access_iterator<typename test_type::iterator>);
+                    CHECK(std::random_access_iterator<typename test_type::const_iterator>);
+                }
+                SECTION("construction")
+                {
+                    test_type const rb{1, 2, 3};
+                    CHECK(rb.size() == 3);
+                    CHECK(std::ranges::equal(rb, std::array{1, 2, 3}));
+
+                    test_type const copy = rb;
+                    CHECK(copy == rb);
+                }
+                SECTION("push_back & pop_front")
+                {
+                    test_type rb;
+                    for (int i = 0; i < 20; ++i)
+                    {
+                        rb.push_back(i);
+                        if (rb.size() == rb.capacity())
+                        {
+                            CHECK(rb.full());
+                            rb.pop_front();
+                        }
+                    }
+                    CHECK(rb.size() == rb.capacity() - 1);
+                    CHECK(rb.back() == 19);
+                    CHECK(rb.front() == static_cast<int>(20 - rb.size()));
+                }
+                SECTION("push_front & pop_back")
+                {
+                    test_type rb;
+                    rb.push_front(1);
+                    rb.push_front(2);
+                    rb.push_back(3);
+                    CHECK(std::ranges::equal(rb, std::array{2, 1, 3}));
+                    rb.pop_back();
+                    CHECK(std::ranges::equal(rb, std::array{2, 1}));
+                    rb.pop_front();
+                    CHECK(std::ranges::equal(rb, std::array{1}));
+                    rb.pop_back();
+                    CHECK(rb.empty());
+                }
+                SECTION("element access")
+                {
+                    test_type rb{0, 1, 2};
+                    rb.pop_front();
+                    rb.push_back(3);
+                    rb.push_back(4);
+                    CHECK(rb[0] == 1);
+                    CHECK(rb[3] == 4);
+                    CHECK(rb.begin()[2] == 3);
+                    CHECK(*(rb.end() - 1) == 4);
+                    CHECK(*rb.rbegin() == 4);
+                    CHECK(rb.end() - rb.begin() == 4);
+                }
+                SECTION("as_spans")
+                {
+                    test_type rb{0, 1, 2, 3};
+                    rb.pop_front();
+                    rb.pop_front();
+                    rb.push_back(4);
+                    rb.push_back(5);
+                    auto const [first, second] = rb.as_spans();
+                    CHECK(first.size() + second.size() == rb.size());
+                    CHECK(first.front() == 2);
+                    CHECK(second.back() == 5);
+                }
+                SECTION("erase_if")
+                {
+                    test_type rb{0, 1, 2, 3};
+                    rb.pop_front();
+                    rb.push_back(4);
+                    CHECK(erase_if(rb, [](int i) { return i % 2 == 0; }) == 2);
+                    CHECK(std::ranges::equal(rb, std::array{1, 3}));
+                }
+                SECTION("at", runtime)
+                {
+                    test_type rb{0, 1};
+                    CHECK(rb.at(1) == 1);
+                    REQUIRE_THROWS_AS(std::out_of_range, rb.at(2));
+                }
+            }
+        });
+
+    SECTION("non-trivial element type")
+    {
+        struct non_trivial
+        {
+            constexpr non_trivial(int i)
+                : i(i)
+            {
+            }
+            constexpr ~non_trivial() {}
+            int i;
+        };
+        inplace_ring_buffer<non_trivial, 3> rb;
+        rb.emplace_back(1);
+        rb.emplace_front(0);
+        rb.emplace_back(2);
+        rb.pop_front();
+        rb.emplace_back(3);
+        CHECK(rb.front().i == 1);
+        CHECK(rb.back().i == 3);
+    }
+
+    SECTION("structural")
+    {
+        CHECK(structural_type<inplace_ring_buffer<int, 4>>);
+        CHECK(structural_value<inplace_ring_buffer<int, 4>{1, 2}>);
+    }
+}
+EVAL_TEST_CASE("inplace_ring_buffer");
@@ -0,0 +1,123 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/concept_structural_type_value.hpp"
+#include "structural/inplace_slot_map.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <algorithm>
+#include <array>
+#include <string>
+
+TEST_CASE("inplace_slot_map", "[container][inplace_slot_map]")
+{
+    using namespace structural;
+
+    SECTION("insert & lookup")
+    {
+        inplace_slot_map<int, 4> sm;
+        auto const               a = sm.insert(1);
+        auto const               b = sm.emplace(2);
+        CHECK(sm.size() == 2);
+        CHECK(sm.contains(a));
+        CHECK(sm[a] == 1);
+        CHECK(*sm.find(b) == 2);
+        CHECK(sm.key_of(sm.find(b)) == b);
+        CHECK(!sm.contains(slot_handle{}));
+        CHECK(sm.find(slot_handle{}) == sm.end());
+    }
+    SECTION("erase invalidates only the erased handle")
+    {
+        inplace_slot_map<int, 4> sm;
+        auto const               a = sm.insert(1);
+        auto const               b = sm.insert(2);
+        auto const               c = sm.insert(3);
+        CHECK(sm.erase(a) == 1);
+        CHECK(sm.erase(a) == 0);
+        CHECK(!sm.contains(a));
+        CHECK(sm[b] == 2);
+        CHECK(sm[c] == 3);
+        CHECK(std::ranges::is_permutation(sm, std::array{2, 3}));
+    }
+    SECTION("reused slots get a new generation")
+    {
+        inplace_slot_map<int, 2> sm;
+        auto const               a = sm.insert(1);
+        sm.erase(a);
+        auto const b = sm.insert(2);
+        CHECK(b.index == a.index);
+        CHECK(b != a);
+        CHECK(!sm.contains(a));
+        CHECK(sm[b] == 2);
+    }
+    SECTION("erase while iterating")
+    {
+        inplace_slot_map<int, 8> sm;
+        for (int i = 0; i < 8; ++i)
+            sm.insert(i);
+        for (auto iter = sm.begin(); iter != sm.end();)
+        {
+            if (*iter % 2 == 0)
+                iter = sm.erase(iter);
+            else
+                ++iter;
+        }
+        CHECK(std::ranges::is_permutation(sm, std::array{1, 3, 5, 7}));
+        for (auto iter = sm.begin(); iter != sm.end(); ++iter)
+            CHECK(sm[sm.key_of(iter)] == *iter);
+    }
+    SECTION("clear")
+    {
+        inplace_slot_map<int, 4> sm;
+        auto const               a = sm.insert(1);
+        sm.clear();
+        CHECK(sm.empty());
+        CHECK(!sm.contains(a));
+        sm.insert(2);
+        CHECK(sm.size() == 1);
+    }
+    SECTION("at", runtime)
+    {
+        inplace_slot_map<int, 4> sm;
+        auto const               a = sm.insert(1);
+        CHECK(sm.at(a) == 1);
+        sm.erase(a);
+        REQUIRE_THROWS_AS(std::out_of_range, sm.at(a));
+    }
+    SECTION("non-trivial element type")
+    {
+        inplace_slot_map<bs::string, 4> sm;
+        auto const                      a = sm.insert("a");
+        auto const                      b = sm.insert("b");
+        sm.erase(a);
+        CHECK(sm[b] == "b");
+    }
+    SECTION("structural")
+    {
+        CHECK(structural_type<inplace_slot_map<int, 4>>);
+        CHECK(structural_value<inplace_slot_map<int, 4>{}>);
+    }
+}
+EVAL_TEST_CASE("inplace_slot_map");
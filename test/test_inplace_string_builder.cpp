@@ -0,0 +1,134 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/inplace_string.hpp"
+#include "structural/inplace_string_builder.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <stdexcept>
+#include <string_view>
+
+#if defined(__cpp_lib_format)
+#include <format>
+#endif
+
+TEST_CASE("inplace_string_builder", "[inplace_string_builder]")
+{
+    using namespace structural;
+
+    SECTION("appender")
+    {
+        inplace_string<8> str = "ab";
+        auto const        out = std::ranges::copy(std::string_view("cdef"), appender(str)).out;
+        CHECK(str == "abcdef");
+        CHECK(!out.overflowed());
+    }
+    SECTION("truncating appender")
+    {
+        inplace_string<4> str;
+        auto const out = std::ranges::copy(std::string_view("abcdef"), appender<overflow_policy::truncate>(str)).out;
+        CHECK(str == "abcd");
+        CHECK(out.overflowed());
+    }
+    SECTION("failing appender", runtime)
+    {
+        inplace_string<4> str;
+        bool              thrown = false;
+        try
+        {
+            std::ranges::copy(std::string_view("abcdef"), appender(str));
+        }
+        catch (std::length_error const&)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+        CHECK(str == "abcd");
+    }
+    SECTION("streambuf", runtime)
+    {
+        inplace_string<32> str = "x=";
+        {
+            basic_inplace_streambuf<char, 32> buf(str);
+            std::ostream                      os(&buf);
+            os << 42 << ", y=" << std::setw(5) << 1.5;
+            CHECK(os.good());
+            CHECK(buf.str() == "x=42, y=  1.5");
+            os << '!';
+        }
+        CHECK(str == "x=42, y=  1.5!");
+    }
+    SECTION("builder", runtime)
+    {
+        inplace_string_builder<64> builder;
+        builder << "request " << 17 << " took " << 2.5 << "ms";
+        CHECK(builder.view() == "request 17 took 2.5ms");
+        builder << std::hex << 255;
+        CHECK(builder.str() == "request 17 took 2.5msff");
+
+        builder.str("reset ");
+        builder << std::dec << 1;
+        CHECK(builder.str() == "reset 1");
+    }
+    SECTION("builder fails on overflow", runtime)
+    {
+        inplace_string_builder<8> builder;
+        builder << "1234";
+        CHECK(builder.good());
+        builder << "56789";
+        CHECK(builder.bad());
+        CHECK(builder.overflowed());
+        CHECK(builder.str() == "12345678");
+    }
+    SECTION("builder truncates on overflow", runtime)
+    {
+        inplace_string_builder<8, overflow_policy::truncate> builder;
+        builder << "1234" << 56789 << 'x';
+        CHECK(builder.good());
+        CHECK(builder.overflowed());
+        CHECK(builder.str() == "12345678");
+    }
+    SECTION("builder with initial content", runtime)
+    {
+        inplace_string_builder<16> builder(inplace_string<16>("id="));
+        builder << 7;
+        CHECK(builder.str() == "id=7");
+    }
+#if defined(__cpp_lib_format)
+    SECTION("format_to", runtime)
+    {
+        inplace_string<32> str;
+        std::format_to(appender(str), "{}-{:04}", "id", 42);
+        CHECK(str == "id-0042");
+
+        inplace_string<4> small;
+        std::format_to_n(appender(small), 4, "{}", 123456);
+        CHECK(small == "1234");
+    }
+#endif
+}
+EVAL_TEST_CASE("inplace_string_builder");
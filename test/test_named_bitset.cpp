@@ -26,6 +26,14 @@
 
 #include <bugspray/bugspray.hpp>
 
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <ranges>
+#include <string_view>
+
+#include <cstddef>
+
 STRUCTURAL_MAKE_NAMED_BITSET(empty_bits, empty)
 STRUCTURAL_MAKE_NAMED_BITSET(color_bits, colors, red, green, blue, yellow)
 
@@ -89,6 +97,28 @@ TEST_CASE("named_bitset")
     SECTION("stringification", runtime)
     {
         REQUIRE(c.to_string() == "red | green | blue");
+        REQUIRE(to_string(yellow) == "yellow");
+    }
+    SECTION("to_string_view")
+    {
+        REQUIRE(to_string_view(red) == "red");
+        REQUIRE(to_string_view(yellow) == "yellow");
+    }
+    SECTION("from_string_view")
+    {
+        REQUIRE(from_string_view<color_bits>("red") == red);
+        REQUIRE(from_string_view<color_bits>("yellow") == yellow);
+        REQUIRE(!from_string_view<color_bits>("purple"));
+        REQUIRE(!from_string_view<color_bits>("re"));
+        REQUIRE(!from_string_view<color_bits>(""));
+    }
+    SECTION("to_inplace_string")
+    {
+        REQUIRE(c.to_inplace_string() == "red | green | blue");
+        REQUIRE(colors{yellow}.to_inplace_string() == "yellow");
+        REQUIRE(colors{}.to_inplace_string().empty());
+        REQUIRE(decltype(c.to_inplace_string())::capacity()
+                == std::string_view{"red | green | blue | yellow"}.size());
     }
 
     SECTION("operator&")
@@ -107,6 +137,31 @@ TEST_CASE("named_bitset")
         REQUIRE((c ^ yellow).all());
     }
 
+    SECTION("find")
+    {
+        REQUIRE(c.find_first() == red);
+        REQUIRE(c.find_next(red) == green);
+        REQUIRE(c.find_next(blue) == std::nullopt);
+        REQUIRE(c.find_last() == blue);
+        REQUIRE(colors{}.find_first() == std::nullopt);
+        REQUIRE(colors{}.find_last() == std::nullopt);
+    }
+    SECTION("set_bits")
+    {
+        std::array<color_bits, 3> flags{};
+        std::ranges::copy((red | blue | yellow).set_bits(), flags.begin());
+        REQUIRE(flags == std::array{red, blue, yellow});
+        REQUIRE(std::ranges::empty(colors{}.set_bits()));
+    }
+    SECTION("for_each_set")
+    {
+        std::array<color_bits, 3> flags{};
+        std::size_t               n = 0;
+        (red | blue | yellow).for_each_set([&](color_bits e) { flags[n++] = e; });
+        REQUIRE(n == 3);
+        REQUIRE(flags == std::array{red, blue, yellow});
+    }
+
     SECTION("structural")
     {
         CHECK(structural_value<yellow | red>);
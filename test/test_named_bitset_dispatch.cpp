@@ -0,0 +1,208 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/named_bitset_dispatch.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <cstddef>
+
+STRUCTURAL_MAKE_NAMED_BITSET(light_bits, lights, red, green, blue, yellow)
+STRUCTURAL_MAKE_NAMED_BITSET(option_bits,
+                             options,
+                             o00, o01, o02, o03, o04, o05, o06, o07, o08, o09,
+                             o10, o11, o12, o13, o14, o15, o16, o17, o18, o19)
+
+namespace
+{
+// The if-chain that classify() replaces
+constexpr auto classify_by_if(lights c) -> int
+{
+    using enum light_bits;
+    if (c.test(red) && c.test(green))
+        return 1;
+    if (c.test(red) && !c.test(blue))
+        return 2;
+    if (c.test(red))
+        return 3;
+    if (c.test(yellow))
+        return 4;
+    return 0;
+}
+
+constexpr auto classify(lights c) -> int
+{
+    using namespace structural;
+    using enum light_bits;
+    return dispatch(c,
+                    when<red | green>([] { return 1; }),
+                    when<red, blue>([] { return 2; }),
+                    when<red>([] { return 3; }),
+                    when<yellow>([] { return 4; }),
+                    otherwise([] { return 0; }));
+}
+
+// Mentions 5 of the 20 flags, few enough to tabulate
+constexpr auto classify_by_if(options o) -> int
+{
+    using enum option_bits;
+    if (o.test(o03) && o.test(o17))
+        return 1;
+    if (o.test(o03) && !o.test(o11))
+        return 2;
+    if (o.test(o08) || o.test(o19))
+        return 3;
+    return 0;
+}
+
+constexpr auto classify(options o) -> int
+{
+    using namespace structural;
+    using enum option_bits;
+    return dispatch(o,
+                    when<o03 | o17>([] { return 1; }),
+                    when<o03, o11>([] { return 2; }),
+                    when<o08>([] { return 3; }),
+                    when<o19>([] { return 3; }),
+                    otherwise([] { return 0; }));
+}
+
+// Mentions 14 of the 20 flags, too many to tabulate
+constexpr auto count_groups(options o) -> int
+{
+    using namespace structural;
+    using enum option_bits;
+    return dispatch(o,
+                    when<o00 | o01 | o02 | o03>([] { return 4; }),
+                    when<o04 | o05 | o06, o07>([] { return 3; }),
+                    when<o08 | o09>([] { return 2; }),
+                    when<o10 | o11 | o12 | o13>([] { return 1; }),
+                    otherwise([] { return 0; }));
+}
+
+constexpr auto count_groups_by_if(options o) -> int
+{
+    using enum option_bits;
+    if (o.test_all(o00 | o01 | o02 | o03))
+        return 4;
+    if (o.test_all(o04 | o05 | o06) && !o.test(o07))
+        return 3;
+    if (o.test_all(o08 | o09))
+        return 2;
+    if (o.test_all(o10 | o11 | o12 | o13))
+        return 1;
+    return 0;
+}
+
+// Sets the flags of o selected by the bits of pattern
+constexpr auto spread(std::size_t pattern) -> options
+{
+    options o;
+    for (std::size_t i = 0; i < options::size(); ++i)
+    {
+        if ((pattern >> i) & 1)
+            o.set(static_cast<option_bits>(i));
+    }
+    return o;
+}
+} // namespace
+
+TEST_CASE("named_bitset_dispatch")
+{
+    using namespace structural;
+    using enum light_bits;
+
+    SECTION("first matching case")
+    {
+        REQUIRE(classify(red | green) == 1);
+        REQUIRE(classify(red | green | blue) == 1);
+        REQUIRE(classify(red | yellow) == 2);
+        REQUIRE(classify(red | blue) == 3);
+        REQUIRE(classify(yellow | blue) == 4);
+        REQUIRE(classify(lights{}) == 0);
+        REQUIRE(classify(green | blue) == 0);
+    }
+    SECTION("same as if-chain")
+    {
+        for (std::size_t word = 0; word < 16; ++word)
+        {
+            lights c;
+            for (std::size_t i = 0; i < lights::size(); ++i)
+            {
+                if ((word >> i) & 1)
+                    c.set(static_cast<light_bits>(i));
+            }
+            REQUIRE(classify(c) == classify_by_if(c));
+        }
+    }
+    SECTION("void handlers")
+    {
+        int reds  = 0;
+        int blues = 0;
+        for (lights const c : {lights{red}, red | blue, lights{blue}, lights{green}})
+            dispatch(c, when<red>([&] { ++reds; }), when<blue>([&] { ++blues; }));
+        REQUIRE(reds == 2);
+        REQUIRE(blues == 1);
+    }
+    SECTION("mutable handlers")
+    {
+        int calls = 0;
+        dispatch(lights{red}, when<red>([n = 0, &calls]() mutable { calls = ++n; }));
+        REQUIRE(calls == 1);
+    }
+    SECTION("common result type")
+    {
+        auto const result = dispatch(lights{red}, when<red>([] { return 1; }), otherwise([] { return 2L; }));
+        REQUIRE(result == 1L);
+    }
+    SECTION("exhaustive without otherwise")
+    {
+        auto const parity = [](lights c) {
+            return dispatch(c, when<red>([] { return 1; }), when<lights{}, red>([] { return 0; }));
+        };
+        REQUIRE(parity(red | blue) == 1);
+        REQUIRE(parity(blue) == 0);
+    }
+    SECTION("large bitset", runtime)
+    {
+        for (std::size_t pattern = 0; pattern < (std::size_t{1} << options::size()); pattern += 97)
+        {
+            options const o = spread(pattern);
+            REQUIRE(classify(o) == classify_by_if(o));
+            REQUIRE(count_groups(o) == count_groups_by_if(o));
+        }
+    }
+    SECTION("large bitset at compile time")
+    {
+        using enum option_bits;
+        REQUIRE(classify(o03 | o17 | o11) == 1);
+        REQUIRE(classify(o03 | o00) == 2);
+        REQUIRE(classify(o03 | o11) == 0);
+        REQUIRE(classify(o19 | o11) == 3);
+        REQUIRE(count_groups(o00 | o01 | o02 | o03 | o08 | o09) == 4);
+        REQUIRE(count_groups(o04 | o05 | o06 | o07 | o08 | o09) == 2);
+        REQUIRE(count_groups(o10 | o11 | o12) == 0);
+    }
+}
+EVAL_TEST_CASE("named_bitset_dispatch");
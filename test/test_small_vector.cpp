@@ -0,0 +1,236 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/small_vector.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+// Counts the allocations made through it and its copies
+template<typename T>
+struct counting_allocator
+{
+    using value_type = T;
+
+    explicit counting_allocator(int* allocations) noexcept
+        : allocations(allocations)
+    {
+    }
+    template<typename U>
+    counting_allocator(counting_allocator<U> const& other) noexcept
+        : allocations(other.allocations)
+    {
+    }
+
+    auto allocate(std::size_t n) -> T*
+    {
+        ++*allocations;
+        return std::allocator<T>{}.allocate(n);
+    }
+    void deallocate(T* p, std::size_t n) noexcept { std::allocator<T>{}.deallocate(p, n); }
+
+    auto operator==(counting_allocator const&) const -> bool = default;
+
+    int* allocations;
+};
+
+// Throws when copying a negative value
+struct throwing_copy
+{
+    explicit throwing_copy(int i)
+        : value(std::to_string(i))
+    {
+    }
+    throwing_copy(throwing_copy const& other)
+        : value(other.value)
+    {
+        if (value.front() == '-')
+            throw std::runtime_error("throwing_copy");
+    }
+    throwing_copy(throwing_copy&&) noexcept                    = default;
+    auto operator=(throwing_copy&&) noexcept -> throwing_copy& = default;
+
+    std::string value;
+};
+} // namespace
+
+TEST_CASE("small_vector", "[container][small_vector]")
+{
+    using namespace structural;
+
+    SECTION("starts inline and spills to the allocator")
+    {
+        small_vector<int, 4> v{1, 2, 3, 4};
+        CHECK(v.is_inline());
+        CHECK(v.capacity() == 4);
+        v.push_back(5);
+        CHECK(!v.is_inline());
+        CHECK(v.capacity() >= 5);
+        CHECK(std::ranges::equal(v, std::array{1, 2, 3, 4, 5}));
+
+        v.resize(2);
+        v.shrink_to_fit();
+        CHECK(v.is_inline());
+        CHECK(std::ranges::equal(v, std::array{1, 2}));
+    }
+    SECTION("insert & erase")
+    {
+        small_vector<int, 4> v{1, 2};
+        v.insert(v.begin() + 1, {10, 11, 12});
+        CHECK(std::ranges::equal(v, std::array{1, 10, 11, 12, 2}));
+        v.emplace(v.begin(), 0);
+        CHECK(std::ranges::equal(v, std::array{0, 1, 10, 11, 12, 2}));
+        v.erase(v.begin() + 2, v.begin() + 4);
+        CHECK(std::ranges::equal(v, std::array{0, 1, 12, 2}));
+        v.push_back(v.front());
+        CHECK(v.back() == 0);
+        CHECK(erase(v, 0) == 2);
+        CHECK(std::ranges::equal(v, std::array{1, 12, 2}));
+    }
+    SECTION("insert a range of the same vector")
+    {
+        small_vector<int, 4> v{1, 2, 3, 4};
+        v.insert(v.begin(), v.begin() + 1, v.begin() + 3);
+        CHECK(std::ranges::equal(v, std::array{2, 3, 1, 2, 3, 4}));
+        v.insert(v.begin() + 1, v.begin() + 4, v.end());
+        CHECK(std::ranges::equal(v, std::array{2, 3, 4, 3, 1, 2, 3, 4}));
+    }
+    SECTION("copy & move")
+    {
+        small_vector<int, 2> inline_v{1, 2};
+        small_vector<int, 2> heap_v{1, 2, 3};
+
+        auto inline_copy = inline_v;
+        auto heap_copy   = heap_v;
+        CHECK(inline_copy == inline_v);
+        CHECK(heap_copy == heap_v);
+
+        auto moved = std::move(heap_copy);
+        CHECK(moved == heap_v);
+        CHECK(heap_copy.empty());
+
+        moved = std::move(inline_copy);
+        CHECK(moved == inline_v);
+        CHECK(moved.is_inline());
+    }
+    SECTION("conversion from and to inplace_vector")
+    {
+        inplace_vector<int, 8> const iv{1, 2, 3};
+        small_vector<int, 2> const   v(iv);
+        CHECK(std::ranges::equal(v, iv));
+        CHECK(static_cast<inplace_vector<int, 3>>(v) == inplace_vector<int, 3>{1, 2, 3});
+    }
+    SECTION("non-trivially destructible element type")
+    {
+        struct non_trivial
+        {
+            constexpr non_trivial(int i)
+                : i(i)
+            {
+            }
+            constexpr ~non_trivial() {}
+            int i;
+        };
+        small_vector<non_trivial, 4> v;
+        CHECK(v.is_inline());
+        for (int i = 0; i < 5; ++i)
+            v.emplace_back(i);
+        v.emplace(v.begin() + 2, 10);
+        v.erase(v.begin());
+        v.insert(v.end(), v.begin(), v.begin() + 2);
+        CHECK(v.size() == 7);
+        CHECK(v.front().i == 1);
+        CHECK(v[1].i == 10);
+        CHECK(v[4].i == 4);
+        CHECK(v[5].i == 1);
+        CHECK(v[6].i == 10);
+        v.resize(1, non_trivial{0});
+        v.shrink_to_fit();
+        CHECK(v.size() == 1);
+        CHECK(v.front().i == 1);
+        v.clear();
+        v.shrink_to_fit();
+        CHECK(v.is_inline());
+    }
+    SECTION("non-trivial element type", runtime)
+    {
+        small_vector<std::string, 2> v;
+        for (char c = 'a'; c < 'f'; ++c)
+            v.insert(v.begin() + v.size() / 2, std::string(32, c));
+        v.emplace_back(v.front());
+        CHECK(v.size() == 6);
+        CHECK(v.front() == v.back());
+        v.erase(v.begin(), v.begin() + 4);
+        v.shrink_to_fit();
+        CHECK(v.is_inline());
+        CHECK(v.size() == 2);
+    }
+    SECTION("non-trivial elements stay inline without allocating", runtime)
+    {
+        int                                                           allocations = 0;
+        small_vector<std::string, 4, counting_allocator<std::string>> v{counting_allocator<std::string>(&allocations)};
+        for (char c = 'a'; c < 'e'; ++c)
+            v.emplace_back(32, c);
+        v.erase(v.begin());
+        v.insert(v.begin(), v.back());
+        CHECK(v.is_inline());
+        CHECK(v.capacity() == 4);
+        CHECK(allocations == 0);
+
+        v.emplace_back(32, 'e');
+        CHECK(!v.is_inline());
+        CHECK(allocations == 1);
+        v.resize(4);
+        v.shrink_to_fit();
+        CHECK(v.is_inline());
+        CHECK(v.front() == std::string(32, 'd'));
+    }
+    SECTION("a throwing element leaves the vector unchanged", runtime)
+    {
+        small_vector<throwing_copy, 4> v;
+        for (int i = 0; i < 3; ++i)
+            v.emplace_back(i);
+        std::array const source{throwing_copy(7), throwing_copy(-1)};
+        for (auto const capacity : {4, 8}) // grows while inserting, then fits into the allocated memory
+        {
+            v.reserve(capacity);
+            for (auto const pos : {0, 1, 3})
+            {
+                CHECK_THROWS_AS(std::runtime_error, v.insert(v.begin() + pos, source.begin(), source.end()));
+                CHECK(v.size() == 3);
+                CHECK(v[0].value == "0");
+                CHECK(v[1].value == "1");
+                CHECK(v[2].value == "2");
+            }
+        }
+    }
+}
+EVAL_TEST_CASE("small_vector");
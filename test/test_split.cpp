@@ -0,0 +1,116 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/inplace_string.hpp"
+#include "structural/inplace_vector.hpp"
+#include "structural/split.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+
+namespace
+{
+// Checks that split() produces the same pieces as std::views::split
+constexpr auto agrees_with_views_split(std::string_view str, char delimiter) -> bool
+{
+    auto reference = str | std::views::split(delimiter);
+    auto actual    = structural::split(str, delimiter);
+    auto it        = actual.begin();
+    for (auto&& piece : reference)
+    {
+        if (it == actual.end() || !std::ranges::equal(*it, piece))
+            return false;
+        ++it;
+    }
+    return it == actual.end();
+}
+} // namespace
+
+TEST_CASE("split", "[split]")
+{
+    using namespace structural;
+
+    SECTION("concepts")
+    {
+        CHECK(std::ranges::forward_range<split_view<char>>);
+        CHECK(std::ranges::view<split_view<char>>);
+        CHECK(std::ranges::borrowed_range<split_view<char>>);
+        CHECK(std::ranges::forward_range<tokenize_view<char>>);
+        CHECK(std::ranges::view<tokenize_view<char>>);
+        CHECK(std::ranges::borrowed_range<tokenize_view<char>>);
+    }
+    SECTION("split")
+    {
+        for (std::string_view str : {"", ",", "a", "a,b", "a,,b", ",a,", "abc,de,,f,", ",,,"})
+            CHECK(agrees_with_views_split(str, ','));
+        CHECK(std::ranges::distance(split("", ',')) == 0);
+        CHECK(std::ranges::distance(split("a,", ',')) == 2);
+    }
+    SECTION("split inplace_string")
+    {
+        inplace_string<32> const        record = "id,name,,42";
+        std::array<std::string_view, 4> pieces{};
+        std::ranges::copy(split(record, ','), pieces.begin());
+        CHECK(pieces == std::array<std::string_view, 4>{"id", "name", "", "42"});
+        CHECK(pieces[1].data() == record.data() + 3);
+    }
+    SECTION("split wide strings")
+    {
+        inplace_u32string<16> const str = U"x;yz";
+        auto const                  pieces = split(str, U';');
+        CHECK(std::ranges::equal(*pieces.begin(), std::u32string_view(U"x")));
+        CHECK(std::ranges::distance(pieces) == 2);
+    }
+    SECTION("tokenize")
+    {
+        auto const tokens = tokenize("  GET /index.html\tHTTP/1.1  \r\n", " \t\r\n");
+        CHECK(std::ranges::equal(tokens, std::array<std::string_view, 3>{"GET", "/index.html", "HTTP/1.1"}));
+        CHECK(std::ranges::distance(tokenize("", " ")) == 0);
+        CHECK(std::ranges::distance(tokenize("   ", " ")) == 0);
+        CHECK(std::ranges::distance(tokenize("one", std::string_view(" "))) == 1);
+    }
+    SECTION("tokenize long input")
+    {
+        inplace_string<64> const str = "alpha beta,gamma;;delta    epsilon,zeta eta;theta iota kappa";
+        CHECK(std::ranges::distance(tokenize(str, " ,;")) == 10);
+        CHECK(*std::ranges::next(tokenize(str, " ,;").begin(), 9) == "kappa");
+    }
+    SECTION("split_into")
+    {
+        auto const views = split_into<inplace_vector<std::string_view, 4>>("a,bc,,d", ',');
+        CHECK(views.size() == 4);
+        CHECK(views[1] == "bc");
+        CHECK(views[2].empty());
+
+        auto const fields = split_into<inplace_vector<inplace_string<8>, 3>>("x,yy,zzz", ',');
+        CHECK(fields.size() == 3);
+        CHECK(fields[2] == "zzz");
+    }
+}
+EVAL_TEST_CASE("split");
@@ -0,0 +1,145 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/spsc_queue.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// Pushes the values [0, n) through the queue from a separate producer thread and returns them in the order received.
+template<std::size_t Capacity>
+auto transfer_concurrently(int n, bool batched) -> std::vector<int>
+{
+    auto queue = std::make_unique<structural::spsc_queue<int, Capacity>>();
+
+    std::thread producer(
+        [&]
+        {
+            std::array<int, 7> batch{};
+            for (int i = 0; i < n;)
+            {
+                if (batched)
+                {
+                    auto const count = std::min<int>(batch.size(), n - i);
+                    for (int j = 0; j < count; ++j)
+                        batch[j] = i + j;
+                    i += static_cast<int>(queue->push_n(batch.begin(), count));
+                }
+                else if (queue->try_push(i))
+                    ++i;
+            }
+        });
+
+    std::vector<int> received;
+    while (static_cast<int>(received.size()) < n)
+    {
+        if (batched)
+            queue->pop_n(std::back_inserter(received), 5);
+        else if (auto e = queue->try_pop())
+            received.push_back(*e);
+    }
+    producer.join();
+    return received;
+}
+
+auto single_threaded_round_trip() -> bool
+{
+    structural::spsc_queue<std::unique_ptr<int>, 3> queue;
+    if (!queue.empty() || !queue.try_push(std::make_unique<int>(1)) || !queue.try_emplace(new int(2))
+        || !queue.try_push(std::make_unique<int>(3)))
+        return false;
+    if (queue.try_push(std::make_unique<int>(4)) || queue.size() != 3)
+        return false;
+
+    auto first = queue.try_pop();
+    if (!first || **first != 1)
+        return false;
+
+    std::vector<std::unique_ptr<int>> rest;
+    return queue.pop_n(std::back_inserter(rest), 5) == 2 && *rest[0] == 2 && *rest[1] == 3 && !queue.try_pop();
+}
+
+auto batched_round_trip() -> bool
+{
+    structural::spsc_queue<int, 4> queue;
+    std::array const               values{1, 2, 3, 4, 5, 6};
+    if (queue.push_n(values.begin(), values.size()) != 4)
+        return false;
+
+    std::array<int, 2> out{};
+    if (queue.pop_n(out.begin(), out.size()) != 2 || out != std::array{1, 2})
+        return false;
+    return queue.push_n(values.begin() + 4, 2) == 2 && queue.size() == 4;
+}
+
+// A batch must not be cut short by a cached peer index that is merely outdated rather than full or empty.
+auto batches_see_peer_progress() -> bool
+{
+    structural::spsc_queue<int, 4> queue;
+    std::array const               values{1, 2, 3, 4};
+    std::array<int, 4>             out{};
+    if (queue.push_n(values.begin(), 2) != 2 || queue.pop_n(out.begin(), 2) != 2)
+        return false;
+    if (queue.push_n(values.begin(), 4) != 4 || queue.pop_n(out.begin(), 1) != 1)
+        return false;
+    if (queue.push_n(values.begin(), 1) != 1)
+        return false;
+    return queue.pop_n(out.begin(), 4) == 4 && out == std::array{2, 3, 4, 1};
+}
+
+auto is_sequence(std::vector<int> const& received) -> bool
+{
+    for (int i = 0; i < static_cast<int>(received.size()); ++i)
+        if (received[i] != i)
+            return false;
+    return true;
+}
+} // namespace
+
+TEST_CASE("spsc_queue", "[container][spsc_queue]")
+{
+    SECTION("single thread", runtime)
+    {
+        CHECK(single_threaded_round_trip());
+        CHECK(batched_round_trip());
+        CHECK(batches_see_peer_progress());
+    }
+
+    SECTION("two threads", runtime)
+    {
+        constexpr int n = 100'000;
+        CHECK(is_sequence(transfer_concurrently<16>(n, false)));
+        CHECK(is_sequence(transfer_concurrently<16>(n, true)));
+        CHECK(is_sequence(transfer_concurrently<13>(n, false)));
+        CHECK(is_sequence(transfer_concurrently<13>(n, true)));
+    }
+}
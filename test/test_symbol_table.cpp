@@ -0,0 +1,117 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/concept_structural_type_value.hpp"
+#include "structural/inplace_unordered_map.hpp"
+#include "structural/symbol_table.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <array>
+#include <string_view>
+
+namespace
+{
+using keywords = structural::symbol_set<8, "if", "else", "for", "while", "return", "break", "continue", "do", "switch">;
+} // namespace
+
+TEST_CASE("symbol_table", "[container][symbol_table]")
+{
+    using namespace structural;
+
+    SECTION("symbol_set")
+    {
+        CHECK(keywords::size == 9);
+        for (std::size_t i = 0; i < keywords::size; ++i)
+            CHECK(keywords::find(keywords::names[i]) == symbol{static_cast<std::uint32_t>(i)});
+        CHECK(!keywords::find("iff").has_value());
+        CHECK(!keywords::find("").has_value());
+        CHECK(!keywords::find("Return").has_value());
+        CHECK(STRUCTURAL_SYMBOL(keywords, "while") == symbol{3});
+    }
+    SECTION("empty symbol_set")
+    {
+        using empty = symbol_set<8>;
+        CHECK(empty::size == 0);
+        CHECK(!empty::find("if").has_value());
+    }
+    SECTION("intern")
+    {
+        symbol_table<16, 16> table;
+        CHECK(table.size() == 0);
+        symbol const foo = table.intern("foo");
+        symbol const bar = table.intern("bar");
+        CHECK(foo != bar);
+        CHECK(table.intern("foo") == foo);
+        CHECK(table.size() == 2);
+        CHECK(table.name(foo) == "foo");
+        CHECK(table.name(bar) == "bar");
+        CHECK(table.contains("bar"));
+        CHECK(!table.contains("baz"));
+        CHECK(table.find("baz") == std::nullopt);
+    }
+    SECTION("static symbols match interned ones")
+    {
+        symbol_table<32, 8, keywords> table;
+        CHECK(table.size() == keywords::size);
+        CHECK(table.intern("return") == STRUCTURAL_SYMBOL(keywords, "return"));
+        CHECK(table.intern(std::string_view("switch")) == STRUCTURAL_SYMBOL(keywords, "switch"));
+        CHECK(table.name(STRUCTURAL_SYMBOL(keywords, "do")) == "do");
+        CHECK(table.size() == keywords::size);
+
+        symbol const x = table.intern("x");
+        CHECK(x.id == keywords::size);
+        CHECK(table.intern("x") == x);
+        CHECK(table.size() == keywords::size + 1);
+    }
+    SECTION("fill to capacity")
+    {
+        constexpr std::array<std::string_view, 8> words{"a", "bb", "ccc", "dddd", "e", "ff", "ggg", "hhhh"};
+        symbol_table<8, 4> table;
+        for (auto w : words)
+            table.intern(w);
+        CHECK(table.size() == table.capacity());
+        for (std::size_t i = 0; i < words.size(); ++i)
+        {
+            CHECK(table.find(words[i]) == symbol{static_cast<std::uint32_t>(i)});
+            CHECK(table.name(symbol{static_cast<std::uint32_t>(i)}) == words[i]);
+        }
+    }
+    SECTION("symbols as map keys")
+    {
+        symbol_table<16, 8, keywords> table;
+        inplace_unordered_map<symbol, int, 8> counts;
+        for (std::string_view word : {"if", "x", "else", "if", "x", "if"})
+            ++counts[table.intern(word)];
+        CHECK(counts.at(STRUCTURAL_SYMBOL(keywords, "if")) == 3);
+        CHECK(counts.at(STRUCTURAL_SYMBOL(keywords, "else")) == 1);
+        CHECK(counts.at(table.intern("x")) == 2);
+    }
+    SECTION("structural")
+    {
+        CHECK(structural_type<symbol>);
+        CHECK(structural_value<symbol{4}>);
+    }
+}
+EVAL_TEST_CASE("symbol_table");
@@ -0,0 +1,158 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "structural/inplace_string.hpp"
+#include "structural/utf.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <array>
+#include <random>
+#include <string_view>
+
+namespace
+{
+// Long enough to take the block paths at run time, with one, two, three and four byte sequences crossing block edges
+constexpr std::u8string_view mixed = u8"ASCII text, then Grüße aus Köln, 東京都の天気は晴れ, and 🎉🙂 emoji. Done!";
+constexpr std::u16string_view mixed_u16 = u"ASCII text, then Grüße aus Köln, 東京都の天気は晴れ, and 🎉🙂 emoji. Done!";
+constexpr std::u32string_view mixed_u32 = U"ASCII text, then Grüße aus Köln, 東京都の天気は晴れ, and 🎉🙂 emoji. Done!";
+
+constexpr std::array<std::string_view, 14> malformed{
+    "\x80",             // Stray continuation
+    "\xc3",             // Truncated
+    "\xc0\xaf",         // Overlong two byte
+    "\xc1\xbf",         // Overlong two byte
+    "\xe0\x80\xaf",     // Overlong three byte
+    "\xed\xa0\x80",     // Surrogate
+    "\xf0\x80\x80\xaf", // Overlong four byte
+    "\xf4\x90\x80\x80", // Above U+10FFFF
+    "\xf5\x80\x80\x80", // Invalid leading byte
+    "\xff",             // Invalid byte
+    "\xe2\x82",         // Truncated three byte
+    "\xe2\x28\xa1",     // Missing continuation
+    "\xf0\x9f\x98",     // Truncated four byte
+    "a\xf0\x9f\x98\x80\x80",
+};
+} // namespace
+
+TEST_CASE("utf", "[utf]")
+{
+    using namespace structural;
+
+    SECTION("validate_utf8")
+    {
+        CHECK(validate_utf8(u8""));
+        CHECK(validate_utf8(mixed));
+        CHECK(validate_utf8(std::string_view("\xf4\x8f\xbf\xbf")));
+        CHECK(validate_utf8(std::string_view("\xed\x9f\xbf")));
+        for (auto str : malformed)
+            CHECK(!validate_utf8(str));
+    }
+    SECTION("validate_utf8 at block edges", runtime)
+    {
+        for (auto str : malformed)
+        {
+            for (std::size_t offset = 0; offset < 34; ++offset)
+            {
+                inplace_string<80> s;
+                for (std::size_t i = 0; i < offset; ++i)
+                    s.push_back('x');
+                s.append(str);
+                CHECK(!validate_utf8(s));
+                for (std::size_t i = offset; i < 40; ++i)
+                    s.push_back('y');
+                CHECK(!validate_utf8(s));
+            }
+        }
+    }
+    SECTION("validate_utf8 agrees with scalar kernel", runtime)
+    {
+        std::mt19937 rng(42);
+        for (int round = 0; round < 20000; ++round)
+        {
+            inplace_u8string<96> str(mixed.data(), mixed.size());
+            for (int k = 0; k < 2; ++k)
+                str[rng() % str.size()] = static_cast<char8_t>(rng());
+            CHECK(validate_utf8(str) == detail::utf::validate_scalar(str.data(), str.size()));
+        }
+    }
+    SECTION("validate_utf16")
+    {
+        CHECK(validate_utf16(mixed_u16));
+        CHECK(!validate_utf16(u"\xd83c"));
+        CHECK(!validate_utf16(u"\xdf89 x"));
+        CHECK(!validate_utf16(u"\xd83c x"));
+    }
+    SECTION("utf8_length & utf16_length")
+    {
+        CHECK(utf8_length(u8"") == 0);
+        CHECK(utf8_length(mixed) == mixed_u32.size());
+        CHECK(utf8_length(std::string_view("Grüße")) == 5);
+        CHECK(utf16_length(mixed) == mixed_u16.size());
+        CHECK(utf16_length(std::string_view("\xf0\x9f\x8e\x89")) == 2);
+    }
+    SECTION("transcode utf8 to utf16")
+    {
+        inplace_u8string<96> const str(mixed.data(), mixed.size());
+        auto const                 result = transcode<char16_t>(str);
+        CHECK(result.has_value());
+        CHECK(std::u16string_view(*result) == mixed_u16);
+        CHECK(result->capacity() == transcoded_capacity<char8_t, char16_t, 96>);
+        CHECK(transcoded_capacity<char8_t, char16_t, 96> == 96);
+    }
+    SECTION("transcode into given type")
+    {
+        inplace_u8string<96> const str(mixed.data(), mixed.size());
+        auto const                 result = transcode<inplace_u16string<mixed_u16.size()>>(str);
+        CHECK(result.has_value());
+        CHECK(result->size() == result->capacity());
+        CHECK(std::u16string_view(*result) == mixed_u16);
+    }
+    SECTION("transcode between all encodings")
+    {
+        inplace_u8string<96> const  u8(mixed.data(), mixed.size());
+        inplace_u16string<96> const u16(mixed_u16.data(), mixed_u16.size());
+        inplace_u32string<96> const u32(mixed_u32.data(), mixed_u32.size());
+        CHECK(std::u32string_view(*transcode<char32_t>(u8)) == mixed_u32);
+        CHECK(std::u8string_view(*transcode<char8_t>(u16)) == mixed);
+        CHECK(std::u32string_view(*transcode<char32_t>(u16)) == mixed_u32);
+        CHECK(std::u8string_view(*transcode<char8_t>(u32)) == mixed);
+        CHECK(std::u16string_view(*transcode<char16_t>(u32)) == mixed_u16);
+        CHECK(transcoded_capacity<char16_t, char8_t, 96> == 3 * 96);
+        CHECK(transcoded_capacity<char32_t, char16_t, 96> == 2 * 96);
+    }
+    SECTION("transcode char as utf8")
+    {
+        inplace_string<16> const str = "Gr\xc3\xbc\xc3\x9f" "e";
+        CHECK(std::u16string_view(*transcode<char16_t>(str)) == u"Grüße");
+    }
+    SECTION("transcode malformed input")
+    {
+        for (auto str : malformed)
+            CHECK(!transcode<char16_t>(inplace_string<16>(str.data(), str.size())).has_value());
+        CHECK(!transcode<char8_t>(inplace_u16string<4>(u"a\xd800")).has_value());
+        CHECK(!transcode<char8_t>(inplace_u32string<4>(U"a\x110000")).has_value());
+    }
+}
+EVAL_TEST_CASE("utf");